@@ -219,6 +219,51 @@
     #define MAX_STEP_FREQUENCY 40000 // Max step frequency for Ultimaker (5000 pps / half step)
   #endif
 
+  /**
+   * The stepper timer runs at F_CPU / STEPPER_TIMER_PRESCALE.
+   * The stepper ISR runs at up to 20kHz on a 16MHz MCU, scaled with the clock.
+   */
+  #ifndef STEPPER_TIMER_PRESCALE
+    #define STEPPER_TIMER_PRESCALE 8
+  #endif
+  #define STEPPER_TIMER_RATE ((F_CPU) / (STEPPER_TIMER_PRESCALE))
+  #ifndef MAX_ISR_FREQUENCY
+    #define MAX_ISR_FREQUENCY ((F_CPU) / 800UL)
+  #endif
+  #ifndef MULTISTEPPING_LIMIT
+    #define MULTISTEPPING_LIMIT 4
+  #endif
+  #ifndef MULTISTEP_ISR_HEADROOM
+    #define MULTISTEP_ISR_HEADROOM 4
+  #endif
+  #ifndef SPEED_LOOKUPTABLE_SLOW_SIZE
+    #define SPEED_LOOKUPTABLE_SLOW_SIZE 256
+  #endif
+
+  /**
+   * The planner slows short moves down while less motion than this is queued
+   */
+  #if ENABLED(SLOWDOWN) && !defined(SLOWDOWN_BUFFER_US)
+    #define SLOWDOWN_BUFFER_US 100000
+  #endif
+
+  /**
+   * Input shaping impulses per step: ZV has two, ZVD and EI have three
+   */
+  #if ENABLED(INPUT_SHAPING)
+    #if ENABLED(INPUT_SHAPING_ZVD) || ENABLED(INPUT_SHAPING_EI)
+      #define SHAPING_IMPULSES 3
+    #else
+      #define SHAPING_IMPULSES 2
+    #endif
+    #ifndef SHAPING_BUFFER_SIZE
+      #define SHAPING_BUFFER_SIZE 128
+    #endif
+  #endif
+
+  // Extra step ISRs share Timer 1 with the main stepper ISR
+  #define HAS_STEP_ISR_SCHEDULER (ENABLED(LIN_ADVANCE) || ENABLED(INPUT_SHAPING))
+
   // MS1 MS2 Stepper Driver Microstepping mode table
   #define MICROSTEP1 LOW,LOW
   #define MICROSTEP2 HIGH,LOW
@@ -1105,6 +1150,11 @@
   // Stepper pulse duration, in cycles
   #define STEP_PULSE_CYCLES ((MINIMUM_STEPPER_PULSE) * CYCLES_PER_MICROSECOND)
 
+  // Direction setup time before a shaped step, in cycles
+  #if ENABLED(INPUT_SHAPING)
+    #define DIR_SETUP_CYCLES ((DIRECTION_STEPPER_DELAY) * CYCLES_PER_MICROSECOND / 1000)
+  #endif
+
   #if ENABLED(SDCARD_SORT_ALPHA)
     #define HAS_FOLDER_SORTING (FOLDER_SORTING || ENABLED(SDSORT_GCODE))
   #endif
@@ -105,6 +105,48 @@
     #define DEFAULT_Kc (100) //heating power=Kc*(e_speed)
     #define LPQ_MAX_LEN 50
   #endif
+
+  /**
+   * Model-based heat-up
+   *
+   * M303 also measures a first-order model of the hotend: how far above
+   * ambient each step of power holds it, its time constant, and its dead
+   * time. Heating then stays at full power only until the model predicts
+   * that the heat already on its way will carry the hotend to the target,
+   * and the PID takes over holding the power the target needs. Use M303 U1
+   * to keep the measured model, or set it with M306. Saved in EEPROM.
+   */
+  //#define PID_HEATUP_MODEL
+  #if ENABLED(PID_HEATUP_MODEL)
+    #define DEFAULT_MODEL_GAIN 0            // °C above ambient per step of power (0-255). 0 = no model.
+    #define DEFAULT_MODEL_TIME_CONSTANT 0   // Seconds
+    #define DEFAULT_MODEL_DEAD_TIME 0       // Seconds
+    #define DEFAULT_MODEL_AMBIENT 25        // °C
+  #endif
+#endif
+
+#if ENABLED(PIDTEMP) || ENABLED(PIDTEMPBED)
+  /**
+   * Fixed-point PID
+   *
+   * Run the hotend and bed PID loops inside the temperature ISR with
+   * integer math, once for every full set of ADC readings. Updates are
+   * then exactly PID_dT apart, so main loop delays can't disturb the
+   * derivative term, and manage_heater() no longer does any float PID.
+   * Needs a thermistor on each PID-controlled heater.
+   */
+  //#define PID_FIXED_POINT
+
+  /**
+   * Model-fit PID autotune
+   *
+   * M303 F1 replaces the long run of bang-bang cycles with the heat-up
+   * from cold and one or two relay cycles (C1 or C2). It fits a first-order
+   * model with dead time to them, gets the gains from the model with the
+   * AMIGO rules, and reports how far the model strays from the readings.
+   * Start from a cold heater, since the heat-up is measured from ambient.
+   */
+  //#define PID_AUTOTUNE_MODEL
 #endif
 
 /**
@@ -397,8 +439,13 @@
 // minimum time in microseconds that a movement needs to take if the buffer is emptied.
 #define DEFAULT_MINSEGMENTTIME        50000
 
-// If defined the movements slow down when the look ahead buffer is only half full
+// If defined, short moves slow down when the look ahead buffer holds less than
+// SLOWDOWN_BUFFER_US of motion, stretching them towards DEFAULT_MINSEGMENTTIME
+// as the queued time runs out. Long moves are never slowed.
 #define SLOWDOWN
+#if ENABLED(SLOWDOWN)
+  #define SLOWDOWN_BUFFER_US 100000 // (microseconds) Queued motion to keep ahead of the steppers
+#endif
 
 // Frequency limit
 // See nophead's blog for more info
@@ -410,6 +457,55 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/sec)
 
+// Prepare the acceleration and deceleration step rates in the main loop, as short
+// segments of constant speed, so the stepper ISR doesn't have to calculate them.
+// Not compatible with S_CURVE_ACCELERATION.
+//#define STEP_SEGMENT_BUFFER
+#if ENABLED(STEP_SEGMENT_BUFFER)
+  #define STEP_SEGMENT_BUFFER_SIZE 16 // Segments to prepare ahead. Must be a power of 2.
+  #define STEP_SEGMENT_US 1000        // (microseconds) Duration of each segment
+#endif
+
+// Merge runs of short, nearly collinear moves (e.g., finely sliced curves) into
+// fewer, longer blocks so the planner buffer holds more of the path. A short move
+// is held back until the next move shows whether it can be merged. The merged
+// move ends exactly at the last target and extrudes the total E.
+//#define SEGMENT_MERGE
+#if ENABLED(SEGMENT_MERGE)
+  #define SEGMENT_MERGE_TOLERANCE   0.01 // (mm) Largest distance of any merged point from the new line
+  #define SEGMENT_MERGE_MAX_LENGTH  1.0  // (mm) Only moves up to this length are merged
+  #define SEGMENT_MERGE_MAX_COUNT   8    // Most moves merged into one block
+#endif
+
+// Let heater targets, output pins and LEDs change as the next queued move starts,
+// like the fan speeds, instead of waiting for all moves to finish first.
+// The planner's add_sync_event() queues the change.
+//#define BLOCK_SYNC_EVENTS
+#if ENABLED(BLOCK_SYNC_EVENTS)
+  #define BLOCK_SYNC_EVENT_BUFFER_SIZE 16 // Must be a power of 2
+#endif
+
+// Cancel the ringing of the X and Y axes at their resonance frequency. Each X and Y
+// step is split into impulses spread over half (ZV) or one (ZVD, EI) ringing period,
+// so consecutive moves blend into each other. Set the frequency and damping ratio
+// with M593 X Y F D and save them with M500. A frequency of 0 turns shaping off.
+//#define INPUT_SHAPING
+#if ENABLED(INPUT_SHAPING)
+  //#define INPUT_SHAPING_ZVD             // Three impulses. Tolerates more frequency error than ZV.
+  //#define INPUT_SHAPING_EI              // Three impulses. Tolerates the most frequency error.
+  #define SHAPING_FREQ_X    40.0          // (Hz) Resonance frequency of the X axis
+  #define SHAPING_FREQ_Y    40.0          // (Hz) Resonance frequency of the Y axis
+  #define SHAPING_ZETA_X    0.1           // Damping ratio of the X axis (0-1)
+  #define SHAPING_ZETA_Y    0.1           // Damping ratio of the Y axis (0-1)
+  // Step interrupts held for the delayed impulses. Must be a power of 2, up to 256.
+  // X and Y are slowed down if their steps would overflow the buffer, which gets
+  // more likely at lower frequencies and with ZVD and EI.
+  #define SHAPING_BUFFER_SIZE 128
+  // Shaped steps may reverse X or Y right before a step. Hold the new direction this long
+  // before the step for the driver's direction setup time. (A4988: 200, DRV8825: 650, TB6600: 5000)
+  #define DIRECTION_STEPPER_DELAY 1000    // (ns)
+#endif
+
 // Microstep setting (Only functional when stepper driver microstep pins are connected to MCU.
 #define MICROSTEP_MODES {16,16,16,16,16} // [1,2,4,8,16]
 
@@ -674,6 +770,10 @@
  *
  * Assumption: advance = k * (delta velocity)
  * K=0 means advance disabled.
+ *
+ * The planner gives each print move the pressure for its speeds, and the extra
+ * E steps ramp at a constant rate while the speed changes. With a high K the
+ * acceleration is reduced to keep that rate within the E max feedrate.
  * See Marlin documentation for calibration instructions.
  */
 #define LIN_ADVANCE
@@ -755,6 +855,28 @@
 // Set this if you find stepping unreliable, or if using a very fast CPU.
 #define MINIMUM_STEPPER_PULSE 0 // (µs) The smallest stepper pulse allowed
 
+// The stepper timer counts at F_CPU / STEPPER_TIMER_PRESCALE (8 or 64).
+// The step rate tables are generated to suit at compile time.
+//#define STEPPER_TIMER_PRESCALE 8
+
+// Fast moves take 2, 4 or 8 steps per stepper interrupt (up to MULTISTEPPING_LIMIT).
+// The stepper ISR measures its own run time and takes more steps per interrupt
+// whenever it would come sooner than MULTISTEP_ISR_HEADROOM times that run time.
+// It never runs faster than MAX_ISR_FREQUENCY, by default 20kHz at 16MHz.
+#define MULTISTEPPING_LIMIT    8 // 1, 2, 4 or 8
+#define MULTISTEP_ISR_HEADROOM 4 // 4 leaves 3/4 of the CPU for everything else
+//#define MAX_ISR_FREQUENCY 20000
+//#define MULTISTEP_ISR_TICKS 50 // Use a fixed ISR run time (in timer ticks) instead of measuring it
+
+// Rows in the fine step rate table, which has one row per 8 steps/s.
+// Faster rates use the coarse table, with one row per 256 steps/s.
+// More rows give better timing at higher rates, for 4 bytes of flash each.
+//#define SPEED_LOOKUPTABLE_SLOW_SIZE 256
+
+// Add M930 to report the run times of the stepper and temperature interrupts,
+// and how often the stepper interrupt misses its next deadline. M930 R resets.
+//#define ISR_STATISTICS
+
 // @section temperature
 
 // Control heater 0 and heater 1 in parallel.
@@ -243,6 +243,8 @@
   #error "MEASURED_(UPPER|LOWER)_LIMIT is now FILWIDTH_ERROR_MARGIN. Please update your configuration."
 #elif defined(AUTOMATIC_CURRENT_CONTROL)
   #error "AUTOMATIC_CURRENT_CONTROL is now MONITOR_DRIVER_STATUS. Please update your configuration."
+#elif defined(DOUBLE_STEP_FREQUENCY) || defined(QUAD_STEP_FREQUENCY)
+  #error "DOUBLE_STEP_FREQUENCY and QUAD_STEP_FREQUENCY are replaced by MULTISTEPPING_LIMIT, MULTISTEP_ISR_HEADROOM and MAX_ISR_FREQUENCY. Please update your configuration."
 #endif
 
 /**
@@ -509,6 +511,90 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE && Y_MAX_LENGTH >= Y_BED_SIZE,
   #error "Sorry! LIN_ADVANCE is only compatible with Cartesian."
 #endif
 
+/**
+ * Stepper timer requirements
+ */
+#if STEPPER_TIMER_PRESCALE != 8 && STEPPER_TIMER_PRESCALE != 64
+  #error "STEPPER_TIMER_PRESCALE must be 8 or 64."
+#elif MULTISTEPPING_LIMIT != 1 && MULTISTEPPING_LIMIT != 2 && MULTISTEPPING_LIMIT != 4 && MULTISTEPPING_LIMIT != 8
+  #error "MULTISTEPPING_LIMIT must be 1, 2, 4 or 8."
+#elif MULTISTEP_ISR_HEADROOM < 1
+  #error "MULTISTEP_ISR_HEADROOM must be at least 1."
+#elif defined(MULTISTEP_ISR_TICKS) && (MULTISTEP_ISR_TICKS < 0 || MULTISTEP_ISR_TICKS > 255)
+  #error "MULTISTEP_ISR_TICKS must be from 0 to 255."
+#elif MAX_ISR_FREQUENCY > MAX_STEP_FREQUENCY
+  #error "MAX_ISR_FREQUENCY must not exceed MAX_STEP_FREQUENCY."
+#elif SPEED_LOOKUPTABLE_SLOW_SIZE < 256 || SPEED_LOOKUPTABLE_SLOW_SIZE > 1024
+  #error "SPEED_LOOKUPTABLE_SLOW_SIZE must be from 256 to 1024."
+#endif
+
+/**
+ * Step segment buffer requirements
+ */
+#if ENABLED(STEP_SEGMENT_BUFFER)
+  #if ENABLED(S_CURVE_ACCELERATION)
+    #error "STEP_SEGMENT_BUFFER is not compatible with S_CURVE_ACCELERATION."
+  #elif STEP_SEGMENT_BUFFER_SIZE < 2 || STEP_SEGMENT_BUFFER_SIZE > 128 || !IS_POWER_OF_2(STEP_SEGMENT_BUFFER_SIZE)
+    #error "STEP_SEGMENT_BUFFER_SIZE must be a power of 2 from 2 to 128."
+  #elif STEP_SEGMENT_US < 100
+    #error "STEP_SEGMENT_US must be at least 100."
+  #endif
+#endif
+
+/**
+ * Slowdown requirements
+ */
+#if ENABLED(SLOWDOWN) && SLOWDOWN_BUFFER_US < 1000
+  #error "SLOWDOWN_BUFFER_US must be at least 1000."
+#endif
+
+/**
+ * Block sync event requirements
+ */
+#if ENABLED(BLOCK_SYNC_EVENTS) && (BLOCK_SYNC_EVENT_BUFFER_SIZE < 2 || BLOCK_SYNC_EVENT_BUFFER_SIZE > 128 || !IS_POWER_OF_2(BLOCK_SYNC_EVENT_BUFFER_SIZE))
+  #error "BLOCK_SYNC_EVENT_BUFFER_SIZE must be a power of 2 from 2 to 128."
+#endif
+
+/**
+ * Segment merge requirements
+ */
+#if ENABLED(SEGMENT_MERGE)
+  #if SEGMENT_MERGE_MAX_COUNT < 2 || SEGMENT_MERGE_MAX_COUNT > 32
+    #error "SEGMENT_MERGE_MAX_COUNT must be from 2 to 32."
+  #endif
+  static_assert(SEGMENT_MERGE_TOLERANCE > 0, "SEGMENT_MERGE_TOLERANCE must be greater than 0.");
+  static_assert(SEGMENT_MERGE_MAX_LENGTH > 0, "SEGMENT_MERGE_MAX_LENGTH must be greater than 0.");
+#endif
+
+/**
+ * Input shaping requirements
+ */
+#if ENABLED(INPUT_SHAPING)
+  #if IS_KINEMATIC || CORE_IS_XZ || CORE_IS_YZ
+    #error "INPUT_SHAPING requires a Cartesian or COREXY machine."
+  #elif ENABLED(INPUT_SHAPING_ZVD) && ENABLED(INPUT_SHAPING_EI)
+    #error "Enable only one of INPUT_SHAPING_ZVD or INPUT_SHAPING_EI."
+  #elif SHAPING_BUFFER_SIZE < 16 || SHAPING_BUFFER_SIZE > 256 || !IS_POWER_OF_2(SHAPING_BUFFER_SIZE)
+    #error "SHAPING_BUFFER_SIZE must be a power of 2 from 16 to 256."
+  #endif
+  static_assert(SHAPING_FREQ_X >= 0 && SHAPING_FREQ_Y >= 0, "SHAPING_FREQ_[XY] must be 0 or greater.");
+  static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99) && WITHIN(SHAPING_ZETA_Y, 0, 0.99), "SHAPING_ZETA_[XY] must be from 0 to 0.99.");
+  #if CORE_IS_XY
+    // The A and B motors both move X and Y, so they must share one shaper
+    static_assert(SHAPING_FREQ_X == SHAPING_FREQ_Y && SHAPING_ZETA_X == SHAPING_ZETA_Y, "COREXY requires the same SHAPING_FREQ and SHAPING_ZETA for X and Y.");
+  #endif
+#endif
+
+/**
+ * Junction Deviation requirements
+ */
+#if ENABLED(JUNCTION_DEVIATION)
+  #ifndef JUNCTION_DEVIATION_MM
+    #error "JUNCTION_DEVIATION requires JUNCTION_DEVIATION_MM."
+  #endif
+  static_assert(WITHIN(JUNCTION_DEVIATION_MM, 0.01, 0.3), "JUNCTION_DEVIATION_MM must be between 0.01 and 0.3.");
+#endif
+
 /**
  * Parking Extruder requirements
  */
@@ -575,6 +661,41 @@ static_assert(X_MAX_LENGTH >= X_BED_SIZE && Y_MAX_LENGTH >= Y_BED_SIZE,
   #error "To use BED_LIMIT_SWITCHING you must disable PIDTEMPBED."
 #endif
 
+/**
+ * The heat-up model hands over to the hotend PID
+ */
+#if ENABLED(PID_HEATUP_MODEL)
+  #if DISABLED(PIDTEMP)
+    #error "PID_HEATUP_MODEL requires PIDTEMP."
+  #elif ENABLED(PID_OPENLOOP)
+    #error "PID_HEATUP_MODEL is incompatible with PID_OPENLOOP."
+  #endif
+  static_assert(DEFAULT_MODEL_GAIN >= 0 && DEFAULT_MODEL_TIME_CONSTANT >= 0 && DEFAULT_MODEL_DEAD_TIME >= 0,
+    "DEFAULT_MODEL_GAIN, DEFAULT_MODEL_TIME_CONSTANT, and DEFAULT_MODEL_DEAD_TIME can't be negative.");
+#endif
+
+/**
+ * The model-fit autotune tunes a PID
+ */
+#if ENABLED(PID_AUTOTUNE_MODEL) && DISABLED(PIDTEMP) && DISABLED(PIDTEMPBED)
+  #error "PID_AUTOTUNE_MODEL requires PIDTEMP or PIDTEMPBED."
+#endif
+
+/**
+ * Fixed-point PID works in the units of the thermistor lookup tables
+ */
+#if ENABLED(PID_FIXED_POINT)
+  #if DISABLED(PIDTEMP) && DISABLED(PIDTEMPBED)
+    #error "PID_FIXED_POINT requires PIDTEMP or PIDTEMPBED."
+  #elif ENABLED(PIDTEMP) && (!defined(HEATER_0_USES_THERMISTOR) \
+      || (HOTENDS > 1 && !defined(HEATER_1_USES_THERMISTOR)) || (HOTENDS > 2 && !defined(HEATER_2_USES_THERMISTOR)) \
+      || (HOTENDS > 3 && !defined(HEATER_3_USES_THERMISTOR)) || (HOTENDS > 4 && !defined(HEATER_4_USES_THERMISTOR)))
+    #error "PID_FIXED_POINT with PIDTEMP requires a thermistor for every hotend."
+  #elif ENABLED(PIDTEMPBED) && !defined(BED_USES_THERMISTOR)
+    #error "PID_FIXED_POINT with PIDTEMPBED requires a bed thermistor."
+  #endif
+#endif
+
 /**
  * Kinematics
  */
@@ -1088,6 +1209,34 @@ static_assert(1 >= 0
   #error "TEMP_SENSOR_1 is required with TEMP_SENSOR_1_AS_REDUNDANT."
 #endif
 
+/**
+ * Custom thermistors need a pull-up and a Beta value or Steinhart-Hart coefficients
+ */
+#define _USES_THERMISTOR(N) (TEMP_SENSOR_0 == N || TEMP_SENSOR_1 == N || TEMP_SENSOR_2 == N || TEMP_SENSOR_3 == N || TEMP_SENSOR_4 == N || TEMP_SENSOR_BED == N)
+#if _USES_THERMISTOR(1000)
+  #ifndef THERMISTOR_1000_PULLUP_OHMS
+    #error "TEMP_SENSOR 1000 requires THERMISTOR_1000_PULLUP_OHMS."
+  #elif defined(THERMISTOR_1000_SH_C)
+    #if !defined(THERMISTOR_1000_SH_A) || !defined(THERMISTOR_1000_SH_B)
+      #error "THERMISTOR_1000_SH_C requires THERMISTOR_1000_SH_A and THERMISTOR_1000_SH_B."
+    #endif
+  #elif !defined(THERMISTOR_1000_R25_OHMS) || !defined(THERMISTOR_1000_BETA)
+    #error "TEMP_SENSOR 1000 requires THERMISTOR_1000_R25_OHMS and THERMISTOR_1000_BETA, or THERMISTOR_1000_SH_A, _B and _C."
+  #endif
+#endif
+#if _USES_THERMISTOR(1001)
+  #ifndef THERMISTOR_1001_PULLUP_OHMS
+    #error "TEMP_SENSOR 1001 requires THERMISTOR_1001_PULLUP_OHMS."
+  #elif defined(THERMISTOR_1001_SH_C)
+    #if !defined(THERMISTOR_1001_SH_A) || !defined(THERMISTOR_1001_SH_B)
+      #error "THERMISTOR_1001_SH_C requires THERMISTOR_1001_SH_A and THERMISTOR_1001_SH_B."
+    #endif
+  #elif !defined(THERMISTOR_1001_R25_OHMS) || !defined(THERMISTOR_1001_BETA)
+    #error "TEMP_SENSOR 1001 requires THERMISTOR_1001_R25_OHMS and THERMISTOR_1001_BETA, or THERMISTOR_1001_SH_A, _B and _C."
+  #endif
+#endif
+#undef _USES_THERMISTOR
+
 /**
  * Temperature status LEDs
  */
@@ -37,7 +37,7 @@
  */
 
 // Change EEPROM version if the structure changes
-#define EEPROM_VERSION "V50"
+#define EEPROM_VERSION "V53"
 #define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
@@ -99,6 +99,7 @@ typedef struct SettingsDataStruct {
             planner_min_travel_feedrate_mm_s;           // M205 T     planner.min_travel_feedrate_mm_s
   uint32_t  planner_min_segment_time_us;                // M205 B     planner.min_segment_time_us
   float     planner_max_jerk[XYZE];                     // M205 XYZE  planner.max_jerk[XYZE]
+  float     planner_junction_deviation_mm;              // M205 J     planner.junction_deviation_mm
 
   float home_offset[XYZ];                               // M206 XYZ
 
@@ -245,6 +246,17 @@ typedef struct SettingsDataStruct {
   float filament_change_unload_length[MAX_EXTRUDERS],   // M603 T U
         filament_change_load_length[MAX_EXTRUDERS];     // M603 T L
 
+  //
+  // INPUT_SHAPING
+  //
+  float shaping_frequency[2],                           // M593 X Y F
+        shaping_zeta[2];                                // M593 X Y D
+
+  //
+  // PID_HEATUP_MODEL
+  //
+  float heater_model[MAX_EXTRUDERS][4];                 // M306 En K T L A
+
 } SettingsData;
 
 MarlinSettings settings;
@@ -275,7 +287,7 @@ void MarlinSettings::postprocess() {
     recalc_delta_settings();
   #endif
 
-  #if ENABLED(PIDTEMP)
+  #if ENABLED(PIDTEMP) || ENABLED(PID_FIXED_POINT)
     thermalManager.updatePID();
   #endif
 
@@ -307,6 +319,10 @@ void MarlinSettings::postprocess() {
     fwretract.refresh_autoretract();
   #endif
 
+  #if ENABLED(INPUT_SHAPING)
+    stepper.refresh_shaping();
+  #endif
+
   // Refresh steps_to_mm with the reciprocal of axis_steps_per_mm
   // and init stepper.count[], planner.position[] with current_position
   planner.refresh_positioning();
@@ -416,6 +432,12 @@ void MarlinSettings::postprocess() {
     EEPROM_WRITE(planner.min_travel_feedrate_mm_s);
     EEPROM_WRITE(planner.min_segment_time_us);
     EEPROM_WRITE(planner.max_jerk);
+    #if ENABLED(JUNCTION_DEVIATION)
+      EEPROM_WRITE(planner.junction_deviation_mm);
+    #else
+      dummy = 0.02;
+      EEPROM_WRITE(dummy);
+    #endif
 
     _FIELD_TEST(home_offset);
 
@@ -826,6 +848,38 @@ void MarlinSettings::postprocess() {
       for (uint8_t q = MAX_EXTRUDERS * 2; q--;) EEPROM_WRITE(dummy);
     #endif
 
+    //
+    // Input shaping frequencies and damping
+    //
+
+    _FIELD_TEST(shaping_frequency);
+
+    #if ENABLED(INPUT_SHAPING)
+      EEPROM_WRITE(stepper.shaping_frequency);
+      EEPROM_WRITE(stepper.shaping_zeta);
+    #else
+      dummy = 0.0f;
+      for (uint8_t q = 4; q--;) EEPROM_WRITE(dummy);
+    #endif
+
+    //
+    // Hotend heat-up models
+    //
+
+    _FIELD_TEST(heater_model);
+
+    for (uint8_t e = 0; e < MAX_EXTRUDERS; e++) {
+      #if ENABLED(PID_HEATUP_MODEL)
+        if (e < HOTENDS)
+          EEPROM_WRITE(thermalManager.heater_model[e]);
+        else
+      #endif
+        {
+          dummy = 0.0f;
+          for (uint8_t q = 4; q--;) EEPROM_WRITE(dummy);
+        }
+    }
+
     //
     // Validate CRC and Data Size
     //
@@ -930,6 +984,11 @@ void MarlinSettings::postprocess() {
       EEPROM_READ(planner.min_travel_feedrate_mm_s);
       EEPROM_READ(planner.min_segment_time_us);
       EEPROM_READ(planner.max_jerk);
+      #if ENABLED(JUNCTION_DEVIATION)
+        EEPROM_READ(planner.junction_deviation_mm);
+      #else
+        EEPROM_READ(dummy);
+      #endif
 
       //
       // Home Offset (M206)
@@ -1357,6 +1416,36 @@ void MarlinSettings::postprocess() {
         for (uint8_t q = MAX_EXTRUDERS * 2; q--;) EEPROM_READ(dummy);
       #endif
 
+      //
+      // Input shaping frequencies and damping
+      //
+
+      _FIELD_TEST(shaping_frequency);
+
+      #if ENABLED(INPUT_SHAPING)
+        EEPROM_READ(stepper.shaping_frequency);
+        EEPROM_READ(stepper.shaping_zeta);
+      #else
+        for (uint8_t q = 4; q--;) EEPROM_READ(dummy);
+      #endif
+
+      //
+      // Hotend heat-up models
+      //
+
+      _FIELD_TEST(heater_model);
+
+      for (uint8_t e = 0; e < MAX_EXTRUDERS; e++) {
+        #if ENABLED(PID_HEATUP_MODEL)
+          if (e < HOTENDS)
+            EEPROM_READ(thermalManager.heater_model[e]);
+          else
+        #endif
+          {
+            for (uint8_t q = 4; q--;) EEPROM_READ(dummy);
+          }
+      }
+
       eeprom_error = size_error(eeprom_index - (EEPROM_OFFSET));
       if (eeprom_error) {
         SERIAL_ECHO_START();
@@ -1566,6 +1655,9 @@ void MarlinSettings::reset() {
   planner.max_jerk[Y_AXIS] = DEFAULT_YJERK;
   planner.max_jerk[Z_AXIS] = DEFAULT_ZJERK;
   planner.max_jerk[E_AXIS] = DEFAULT_EJERK;
+  #if ENABLED(JUNCTION_DEVIATION)
+    planner.junction_deviation_mm = float(JUNCTION_DEVIATION_MM);
+  #endif
 
   #if HAS_HOME_OFFSET
     ZERO(home_offset);
@@ -1784,6 +1876,22 @@ void MarlinSettings::reset() {
     }
   #endif
 
+  #if ENABLED(PID_HEATUP_MODEL)
+    HOTEND_LOOP() {
+      thermalManager.heater_model[e].gain = DEFAULT_MODEL_GAIN;
+      thermalManager.heater_model[e].time_constant = DEFAULT_MODEL_TIME_CONSTANT;
+      thermalManager.heater_model[e].dead_time = DEFAULT_MODEL_DEAD_TIME;
+      thermalManager.heater_model[e].ambient = DEFAULT_MODEL_AMBIENT;
+    }
+  #endif
+
+  #if ENABLED(INPUT_SHAPING)
+    stepper.shaping_frequency[X_AXIS] = SHAPING_FREQ_X;
+    stepper.shaping_frequency[Y_AXIS] = SHAPING_FREQ_Y;
+    stepper.shaping_zeta[X_AXIS] = SHAPING_ZETA_X;
+    stepper.shaping_zeta[Y_AXIS] = SHAPING_ZETA_Y;
+  #endif
+
   postprocess();
 
   #if ENABLED(EEPROM_CHITCHAT)
@@ -1956,7 +2064,11 @@ void MarlinSettings::reset() {
 
     if (!forReplay) {
       CONFIG_ECHO_START;
-      SERIAL_ECHOLNPGM("Advanced: S<min_feedrate> T<min_travel_feedrate> B<min_segment_time_us> X<max_xy_jerk> Z<max_z_jerk> E<max_e_jerk>");
+      SERIAL_ECHOPGM("Advanced: S<min_feedrate> T<min_travel_feedrate> B<min_segment_time_us> X<max_xy_jerk> Z<max_z_jerk> E<max_e_jerk>");
+      #if ENABLED(JUNCTION_DEVIATION)
+        SERIAL_ECHOPGM(" J<junc_dev>");
+      #endif
+      SERIAL_EOL();
     }
     CONFIG_ECHO_START;
     SERIAL_ECHOPAIR("  M205 S", LINEAR_UNIT(planner.min_feedrate_mm_s));
@@ -1965,7 +2077,11 @@ void MarlinSettings::reset() {
     SERIAL_ECHOPAIR(" X", LINEAR_UNIT(planner.max_jerk[X_AXIS]));
     SERIAL_ECHOPAIR(" Y", LINEAR_UNIT(planner.max_jerk[Y_AXIS]));
     SERIAL_ECHOPAIR(" Z", LINEAR_UNIT(planner.max_jerk[Z_AXIS]));
-    SERIAL_ECHOLNPAIR(" E", LINEAR_UNIT(planner.max_jerk[E_AXIS]));
+    SERIAL_ECHOPAIR(" E", LINEAR_UNIT(planner.max_jerk[E_AXIS]));
+    #if ENABLED(JUNCTION_DEVIATION)
+      SERIAL_ECHOPAIR(" J", LINEAR_UNIT(planner.junction_deviation_mm));
+    #endif
+    SERIAL_EOL();
 
     #if HAS_M206_COMMAND
       if (!forReplay) {
@@ -2163,6 +2279,21 @@ void MarlinSettings::reset() {
 
     #endif // PIDTEMP || PIDTEMPBED
 
+    #if ENABLED(PID_HEATUP_MODEL)
+      if (!forReplay) {
+        CONFIG_ECHO_START;
+        SERIAL_ECHOLNPGM("Heat-up model:");
+      }
+      HOTEND_LOOP() {
+        CONFIG_ECHO_START;
+        SERIAL_ECHOPAIR("  M306 E", e);
+        SERIAL_ECHOPAIR(" K", thermalManager.heater_model[e].gain);
+        SERIAL_ECHOPAIR(" T", thermalManager.heater_model[e].time_constant);
+        SERIAL_ECHOPAIR(" L", thermalManager.heater_model[e].dead_time);
+        SERIAL_ECHOLNPAIR(" A", thermalManager.heater_model[e].ambient);
+      }
+    #endif
+
     #if HAS_LCD_CONTRAST
       if (!forReplay) {
         CONFIG_ECHO_START;
@@ -2366,6 +2497,19 @@ void MarlinSettings::reset() {
         #endif // EXTRUDERS > 2
       #endif // EXTRUDERS == 1
     #endif // ADVANCED_PAUSE_FEATURE
+
+    #if ENABLED(INPUT_SHAPING)
+      if (!forReplay) {
+        CONFIG_ECHO_START;
+        SERIAL_ECHOLNPGM("Input shaping:");
+      }
+      CONFIG_ECHO_START;
+      SERIAL_ECHOPAIR("  M593 X F", stepper.shaping_frequency[X_AXIS]);
+      SERIAL_ECHOLNPAIR(" D", stepper.shaping_zeta[X_AXIS]);
+      CONFIG_ECHO_START;
+      SERIAL_ECHOPAIR("  M593 Y F", stepper.shaping_frequency[Y_AXIS]);
+      SERIAL_ECHOLNPAIR(" D", stepper.shaping_zeta[Y_AXIS]);
+    #endif
   }
 
 #endif // !DISABLE_M503
@@ -110,7 +110,7 @@ struct duration_t {
    * @brief Formats the duration as a string
    * @details String will be formated using a "full" representation of duration
    *
-   * @param buffer The array pointed to must be able to accommodate 21 bytes
+   * @param buffer The array pointed to must be able to accommodate 22 bytes
    *
    * Output examples:
    *  123456789012345678901 (strlen)
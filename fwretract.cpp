@@ -125,17 +125,19 @@ void FWRetract::retract(const bool retracting
   const bool has_zhop = retract_zlift > 0.01;     // Is there a hop set?
   const float old_feedrate_mm_s = feedrate_mm_s;
 
-  // The current position will be the destination for E and Z moves
+  // The current position will be the destination for E and Z moves.
+  // The planner position is shifted instead of set, so there's no need
+  // to wait for the buffered moves and the retract chains with them.
   set_destination_from_current();
-  stepper.synchronize();  // Wait for buffered moves to complete
 
   const float renormalize = 1.0 / planner.e_factor[active_extruder];
 
   if (retracting) {
     // Retract by moving from a faux E position back to the current E position
     feedrate_mm_s = retract_feedrate_mm_s;
-    current_position[E_AXIS] += (swapping ? swap_retract_length : retract_length) * renormalize;
-    sync_plan_position_e();
+    const float retract_e = (swapping ? swap_retract_length : retract_length) * renormalize;
+    current_position[E_AXIS] += retract_e;
+    planner.shift_position_mm(AxisEnum(E_AXIS), retract_e);
     prepare_move_to_destination();
 
     // Is a Z hop set, and has the hop not yet been done?
@@ -145,26 +147,26 @@ void FWRetract::retract(const bool retracting
       hop_amount += retract_zlift;                        // Carriage is raised for retraction hop
       feedrate_mm_s = planner.max_feedrate_mm_s[Z_AXIS];  // Z feedrate to max
       current_position[Z_AXIS] -= retract_zlift;          // Pretend current pos is lower. Next move raises Z.
-      SYNC_PLAN_POSITION_KINEMATIC();                     // Set the planner to the new position
+      planner.shift_position_mm(Z_AXIS, -retract_zlift);  // Shift the planner to the new position
       prepare_move_to_destination();                      // Raise up to the old current pos
     }
   }
   else {
     // If a hop was done and Z hasn't changed, undo the Z hop
     if (hop_amount) {
-      current_position[Z_AXIS] += retract_zlift;          // Pretend current pos is lower. Next move raises Z.
-      SYNC_PLAN_POSITION_KINEMATIC();                     // Set the planner to the new position
+      current_position[Z_AXIS] += hop_amount;             // Pretend current pos is higher. Next move lowers Z.
+      planner.shift_position_mm(Z_AXIS, hop_amount);      // Shift the planner to the new position
       feedrate_mm_s = planner.max_feedrate_mm_s[Z_AXIS];  // Z feedrate to max
-      prepare_move_to_destination();                      // Raise up to the old current pos
+      prepare_move_to_destination();                      // Lower down to the old current pos
       hop_amount = 0.0;                                   // Clear hop
     }
 
     // A retract multiplier has been added here to get faster swap recovery
     feedrate_mm_s = swapping ? swap_retract_recover_feedrate_mm_s : retract_recover_feedrate_mm_s;
 
-    const float move_e = swapping ? swap_retract_length + swap_retract_recover_length : retract_length + retract_recover_length;
-    current_position[E_AXIS] -= move_e * renormalize;
-    sync_plan_position_e();
+    const float move_e = (swapping ? swap_retract_length + swap_retract_recover_length : retract_length + retract_recover_length) * renormalize;
+    current_position[E_AXIS] -= move_e;
+    planner.shift_position_mm(AxisEnum(E_AXIS), -move_e);
     prepare_move_to_destination();  // Recover E
   }
 
@@ -0,0 +1,76 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * HAL_host.cpp - Stand-in hardware for the host build
+ *
+ * Provides the register file, simulated clock, pins, EEPROM and serial
+ * port needed to run the planner and stepper code on a PC.
+ */
+
+#include "HAL_host.h"
+#include "Arduino.h"
+#include "HardwareSerial.h"
+#include <avr/eeprom.h>
+
+volatile uint8_t host_sfr8[HOST_SFR8_COUNT];
+volatile uint16_t host_sfr16[HOST_SFR16_COUNT];
+
+uint64_t host_timer_ticks = 0;
+
+HardwareSerial Serial;
+
+//
+// Time
+//
+unsigned long millis() { return host_timer_ticks / (HOST_TIMER_RATE / 1000UL); }
+unsigned long micros() { return host_timer_ticks * 1000000ULL / (HOST_TIMER_RATE); }
+void delay(unsigned long ms) { host_timer_ticks += ms * (HOST_TIMER_RATE / 1000UL); }
+void delayMicroseconds(unsigned int us) { host_timer_ticks += (uint64_t)us * (HOST_TIMER_RATE) / 1000000UL; }
+
+//
+// Pins. Inputs read as low, which leaves endstops open with the default inverting.
+//
+static uint8_t host_pins[256];
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t pin, uint8_t val) { host_pins[pin] = val; }
+int digitalRead(uint8_t pin) { return host_pins[pin]; }
+int analogRead(uint8_t) { return 0; }
+void analogWrite(uint8_t pin, int val) { host_pins[pin] = val; }
+void attachInterrupt(uint8_t, void (*)(void), int) {}
+
+//
+// EEPROM
+//
+static uint8_t host_eeprom[(E2END) + 1];
+
+uint8_t eeprom_read_byte(const uint8_t *pos) { return host_eeprom[(uintptr_t)pos & (E2END)]; }
+void eeprom_write_byte(uint8_t *pos, const uint8_t value) { host_eeprom[(uintptr_t)pos & (E2END)] = value; }
+
+void eeprom_read_block(void *dst, const void *src, const size_t n) {
+  for (size_t i = 0; i < n; i++) ((uint8_t*)dst)[i] = eeprom_read_byte((const uint8_t*)src + i);
+}
+
+void eeprom_update_block(const void *src, void *dst, const size_t n) {
+  for (size_t i = 0; i < n; i++) eeprom_write_byte((uint8_t*)dst + i, ((const uint8_t*)src)[i]);
+}
@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * HardwareSerial.h - Serial port for the host build
+ *
+ * The host build defines USBCON so that serial.h uses this stand-in for
+ * MYSERIAL. Output goes to stdout; there is no input.
+ */
+
+#ifndef HOST_HARDWARESERIAL_H
+#define HOST_HARDWARESERIAL_H
+
+#include <stdio.h>
+#include "Arduino.h"
+
+class HardwareSerial {
+  public:
+    void begin(const long) {}
+    void flush() {}
+    int available() { return 0; }
+    int read() { return -1; }
+    void checkRx() {}
+
+    void write(const uint8_t c) { putchar(c); }
+    void write(const char *str) { fputs(str, stdout); }
+
+    void print(const char *str)                   { fputs(str, stdout); }
+    void print(const char c, const int=0)         { putchar(c); }
+    void print(const unsigned char n, const int base=DEC) { print((unsigned long)n, base); }
+    void print(const int n, const int base=DEC)   { print((long)n, base); }
+    void print(const unsigned int n, const int base=DEC) { print((unsigned long)n, base); }
+    void print(const long n, const int base=DEC)  { if (base == DEC) printf("%ld", n); else print((unsigned long)n, base); }
+    void print(const unsigned long n, const int base=DEC) { printf(base == HEX ? "%lX" : base == OCT ? "%lo" : "%lu", n); }
+    void print(const double n, const int digits=2) { printf("%.*f", digits, n); }
+
+    void println()                                { putchar('\n'); }
+    template<typename T> void println(const T v)  { print(v); println(); }
+    template<typename T> void println(const T v, const int b) { print(v, b); println(); }
+};
+
+extern HardwareSerial Serial;
+
+#endif // HOST_HARDWARESERIAL_H
@@ -0,0 +1,531 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * avr/io.h - Host stand-in for the AVR register file
+ *
+ * Registers used by the motion core are plain variables, so the firmware
+ * can poke timers and ports freely while the host build simulates it.
+ */
+
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+extern volatile uint8_t host_sfr8[];
+extern volatile uint16_t host_sfr16[];
+
+#define HOST_SFR8_COUNT  81
+#define HOST_SFR16_COUNT 21
+
+// 8-bit registers
+#define PINA    host_sfr8[0]
+#define DDRA    host_sfr8[1]
+#define PORTA   host_sfr8[2]
+#define PINB    host_sfr8[3]
+#define DDRB    host_sfr8[4]
+#define PORTB   host_sfr8[5]
+#define PINC    host_sfr8[6]
+#define DDRC    host_sfr8[7]
+#define PORTC   host_sfr8[8]
+#define PIND    host_sfr8[9]
+#define DDRD    host_sfr8[10]
+#define PORTD   host_sfr8[11]
+#define PINE    host_sfr8[12]
+#define DDRE    host_sfr8[13]
+#define PORTE   host_sfr8[14]
+#define PINF    host_sfr8[15]
+#define DDRF    host_sfr8[16]
+#define PORTF   host_sfr8[17]
+#define PING    host_sfr8[18]
+#define DDRG    host_sfr8[19]
+#define PORTG   host_sfr8[20]
+#define PINH    host_sfr8[21]
+#define DDRH    host_sfr8[22]
+#define PORTH   host_sfr8[23]
+#define PINJ    host_sfr8[24]
+#define DDRJ    host_sfr8[25]
+#define PORTJ   host_sfr8[26]
+#define PINK    host_sfr8[27]
+#define DDRK    host_sfr8[28]
+#define PORTK   host_sfr8[29]
+#define PINL    host_sfr8[30]
+#define DDRL    host_sfr8[31]
+#define PORTL   host_sfr8[32]
+#define TIMSK0  host_sfr8[33]
+#define TIMSK1  host_sfr8[34]
+#define TIMSK2  host_sfr8[35]
+#define TIMSK3  host_sfr8[36]
+#define TIMSK4  host_sfr8[37]
+#define TIMSK5  host_sfr8[38]
+#define TIFR0   host_sfr8[39]
+#define TIFR1   host_sfr8[40]
+#define TCCR0A  host_sfr8[41]
+#define TCCR0B  host_sfr8[42]
+#define TCCR1A  host_sfr8[43]
+#define TCCR1B  host_sfr8[44]
+#define TCCR1C  host_sfr8[45]
+#define TCCR2A  host_sfr8[46]
+#define TCCR2B  host_sfr8[47]
+#define TCCR3A  host_sfr8[48]
+#define TCCR3B  host_sfr8[49]
+#define TCCR3C  host_sfr8[50]
+#define TCCR4A  host_sfr8[51]
+#define TCCR4B  host_sfr8[52]
+#define TCCR4C  host_sfr8[53]
+#define TCCR5A  host_sfr8[54]
+#define TCCR5B  host_sfr8[55]
+#define TCCR5C  host_sfr8[56]
+#define TCNT0   host_sfr8[57]
+#define TCNT2   host_sfr8[58]
+#define OCR0A   host_sfr8[59]
+#define OCR0B   host_sfr8[60]
+#define OCR2A   host_sfr8[61]
+#define OCR2B   host_sfr8[62]
+#define ADCSRA  host_sfr8[63]
+#define ADCSRB  host_sfr8[64]
+#define ADMUX   host_sfr8[65]
+#define DIDR0   host_sfr8[66]
+#define DIDR2   host_sfr8[67]
+#define SREG    host_sfr8[68]
+#define EIMSK   host_sfr8[69]
+#define EICRA   host_sfr8[70]
+#define EICRB   host_sfr8[71]
+#define PCICR   host_sfr8[72]
+#define PCMSK0  host_sfr8[73]
+#define PCMSK1  host_sfr8[74]
+#define PCMSK2  host_sfr8[75]
+#define MCUSR   host_sfr8[76]
+#define SPDR    host_sfr8[77]
+#define SPSR    host_sfr8[78]
+#define SPCR    host_sfr8[79]
+#define EEARL   host_sfr8[80]
+
+// 16-bit registers
+#define TCNT1   host_sfr16[0]
+#define OCR1A   host_sfr16[1]
+#define OCR1B   host_sfr16[2]
+#define OCR1C   host_sfr16[3]
+#define ADC     host_sfr16[4]
+#define OCR3A   host_sfr16[5]
+#define OCR3B   host_sfr16[6]
+#define OCR3C   host_sfr16[7]
+#define OCR4A   host_sfr16[8]
+#define OCR4B   host_sfr16[9]
+#define OCR4C   host_sfr16[10]
+#define OCR5A   host_sfr16[11]
+#define OCR5B   host_sfr16[12]
+#define OCR5C   host_sfr16[13]
+#define TCNT3   host_sfr16[14]
+#define TCNT4   host_sfr16[15]
+#define TCNT5   host_sfr16[16]
+#define ICR1    host_sfr16[17]
+#define ICR3    host_sfr16[18]
+#define ICR4    host_sfr16[19]
+#define ICR5    host_sfr16[20]
+
+// Register bits
+#define OCIE0A  1
+#define OCIE0B  2
+#define OCIE1A  1
+#define OCIE1B  2
+#define TOIE1   0
+#define OCF1A   1
+#define ADEN    7
+#define ADSC    6
+#define ADIF    4
+#define ADIE    3
+#define ADPS0   0
+#define ADPS1   1
+#define ADPS2   2
+#define REFS0   6
+#define MUX5    3
+#define WGM10   0
+#define WGM11   1
+#define WGM12   3
+#define WGM13   4
+#define CS10    0
+#define CS11    1
+#define CS12    2
+#define COM1A0  6
+#define COM1A1  7
+#define SPIF    7
+
+// Port bits
+#define PA0   0
+#define PINA0 0
+#define DDA0  0
+#define PORTA0 0
+#define PA1   1
+#define PINA1 1
+#define DDA1  1
+#define PORTA1 1
+#define PA2   2
+#define PINA2 2
+#define DDA2  2
+#define PORTA2 2
+#define PA3   3
+#define PINA3 3
+#define DDA3  3
+#define PORTA3 3
+#define PA4   4
+#define PINA4 4
+#define DDA4  4
+#define PORTA4 4
+#define PA5   5
+#define PINA5 5
+#define DDA5  5
+#define PORTA5 5
+#define PA6   6
+#define PINA6 6
+#define DDA6  6
+#define PORTA6 6
+#define PA7   7
+#define PINA7 7
+#define DDA7  7
+#define PORTA7 7
+#define PB0   0
+#define PINB0 0
+#define DDB0  0
+#define PORTB0 0
+#define PB1   1
+#define PINB1 1
+#define DDB1  1
+#define PORTB1 1
+#define PB2   2
+#define PINB2 2
+#define DDB2  2
+#define PORTB2 2
+#define PB3   3
+#define PINB3 3
+#define DDB3  3
+#define PORTB3 3
+#define PB4   4
+#define PINB4 4
+#define DDB4  4
+#define PORTB4 4
+#define PB5   5
+#define PINB5 5
+#define DDB5  5
+#define PORTB5 5
+#define PB6   6
+#define PINB6 6
+#define DDB6  6
+#define PORTB6 6
+#define PB7   7
+#define PINB7 7
+#define DDB7  7
+#define PORTB7 7
+#define PC0   0
+#define PINC0 0
+#define DDC0  0
+#define PORTC0 0
+#define PC1   1
+#define PINC1 1
+#define DDC1  1
+#define PORTC1 1
+#define PC2   2
+#define PINC2 2
+#define DDC2  2
+#define PORTC2 2
+#define PC3   3
+#define PINC3 3
+#define DDC3  3
+#define PORTC3 3
+#define PC4   4
+#define PINC4 4
+#define DDC4  4
+#define PORTC4 4
+#define PC5   5
+#define PINC5 5
+#define DDC5  5
+#define PORTC5 5
+#define PC6   6
+#define PINC6 6
+#define DDC6  6
+#define PORTC6 6
+#define PC7   7
+#define PINC7 7
+#define DDC7  7
+#define PORTC7 7
+#define PD0   0
+#define PIND0 0
+#define DDD0  0
+#define PORTD0 0
+#define PD1   1
+#define PIND1 1
+#define DDD1  1
+#define PORTD1 1
+#define PD2   2
+#define PIND2 2
+#define DDD2  2
+#define PORTD2 2
+#define PD3   3
+#define PIND3 3
+#define DDD3  3
+#define PORTD3 3
+#define PD4   4
+#define PIND4 4
+#define DDD4  4
+#define PORTD4 4
+#define PD5   5
+#define PIND5 5
+#define DDD5  5
+#define PORTD5 5
+#define PD6   6
+#define PIND6 6
+#define DDD6  6
+#define PORTD6 6
+#define PD7   7
+#define PIND7 7
+#define DDD7  7
+#define PORTD7 7
+#define PE0   0
+#define PINE0 0
+#define DDE0  0
+#define PORTE0 0
+#define PE1   1
+#define PINE1 1
+#define DDE1  1
+#define PORTE1 1
+#define PE2   2
+#define PINE2 2
+#define DDE2  2
+#define PORTE2 2
+#define PE3   3
+#define PINE3 3
+#define DDE3  3
+#define PORTE3 3
+#define PE4   4
+#define PINE4 4
+#define DDE4  4
+#define PORTE4 4
+#define PE5   5
+#define PINE5 5
+#define DDE5  5
+#define PORTE5 5
+#define PE6   6
+#define PINE6 6
+#define DDE6  6
+#define PORTE6 6
+#define PE7   7
+#define PINE7 7
+#define DDE7  7
+#define PORTE7 7
+#define PF0   0
+#define PINF0 0
+#define DDF0  0
+#define PORTF0 0
+#define PF1   1
+#define PINF1 1
+#define DDF1  1
+#define PORTF1 1
+#define PF2   2
+#define PINF2 2
+#define DDF2  2
+#define PORTF2 2
+#define PF3   3
+#define PINF3 3
+#define DDF3  3
+#define PORTF3 3
+#define PF4   4
+#define PINF4 4
+#define DDF4  4
+#define PORTF4 4
+#define PF5   5
+#define PINF5 5
+#define DDF5  5
+#define PORTF5 5
+#define PF6   6
+#define PINF6 6
+#define DDF6  6
+#define PORTF6 6
+#define PF7   7
+#define PINF7 7
+#define DDF7  7
+#define PORTF7 7
+#define PG0   0
+#define PING0 0
+#define DDG0  0
+#define PORTG0 0
+#define PG1   1
+#define PING1 1
+#define DDG1  1
+#define PORTG1 1
+#define PG2   2
+#define PING2 2
+#define DDG2  2
+#define PORTG2 2
+#define PG3   3
+#define PING3 3
+#define DDG3  3
+#define PORTG3 3
+#define PG4   4
+#define PING4 4
+#define DDG4  4
+#define PORTG4 4
+#define PG5   5
+#define PING5 5
+#define DDG5  5
+#define PORTG5 5
+#define PG6   6
+#define PING6 6
+#define DDG6  6
+#define PORTG6 6
+#define PG7   7
+#define PING7 7
+#define DDG7  7
+#define PORTG7 7
+#define PH0   0
+#define PINH0 0
+#define DDH0  0
+#define PORTH0 0
+#define PH1   1
+#define PINH1 1
+#define DDH1  1
+#define PORTH1 1
+#define PH2   2
+#define PINH2 2
+#define DDH2  2
+#define PORTH2 2
+#define PH3   3
+#define PINH3 3
+#define DDH3  3
+#define PORTH3 3
+#define PH4   4
+#define PINH4 4
+#define DDH4  4
+#define PORTH4 4
+#define PH5   5
+#define PINH5 5
+#define DDH5  5
+#define PORTH5 5
+#define PH6   6
+#define PINH6 6
+#define DDH6  6
+#define PORTH6 6
+#define PH7   7
+#define PINH7 7
+#define DDH7  7
+#define PORTH7 7
+#define PJ0   0
+#define PINJ0 0
+#define DDJ0  0
+#define PORTJ0 0
+#define PJ1   1
+#define PINJ1 1
+#define DDJ1  1
+#define PORTJ1 1
+#define PJ2   2
+#define PINJ2 2
+#define DDJ2  2
+#define PORTJ2 2
+#define PJ3   3
+#define PINJ3 3
+#define DDJ3  3
+#define PORTJ3 3
+#define PJ4   4
+#define PINJ4 4
+#define DDJ4  4
+#define PORTJ4 4
+#define PJ5   5
+#define PINJ5 5
+#define DDJ5  5
+#define PORTJ5 5
+#define PJ6   6
+#define PINJ6 6
+#define DDJ6  6
+#define PORTJ6 6
+#define PJ7   7
+#define PINJ7 7
+#define DDJ7  7
+#define PORTJ7 7
+#define PK0   0
+#define PINK0 0
+#define DDK0  0
+#define PORTK0 0
+#define PK1   1
+#define PINK1 1
+#define DDK1  1
+#define PORTK1 1
+#define PK2   2
+#define PINK2 2
+#define DDK2  2
+#define PORTK2 2
+#define PK3   3
+#define PINK3 3
+#define DDK3  3
+#define PORTK3 3
+#define PK4   4
+#define PINK4 4
+#define DDK4  4
+#define PORTK4 4
+#define PK5   5
+#define PINK5 5
+#define DDK5  5
+#define PORTK5 5
+#define PK6   6
+#define PINK6 6
+#define DDK6  6
+#define PORTK6 6
+#define PK7   7
+#define PINK7 7
+#define DDK7  7
+#define PORTK7 7
+#define PL0   0
+#define PINL0 0
+#define DDL0  0
+#define PORTL0 0
+#define PL1   1
+#define PINL1 1
+#define DDL1  1
+#define PORTL1 1
+#define PL2   2
+#define PINL2 2
+#define DDL2  2
+#define PORTL2 2
+#define PL3   3
+#define PINL3 3
+#define DDL3  3
+#define PORTL3 3
+#define PL4   4
+#define PINL4 4
+#define DDL4  4
+#define PORTL4 4
+#define PL5   5
+#define PINL5 5
+#define DDL5  5
+#define PORTL5 5
+#define PL6   6
+#define PINL6 6
+#define DDL6  6
+#define PORTL6 6
+#define PL7   7
+#define PINL7 7
+#define DDL7  7
+#define PORTL7 7
+
+#define RAMEND 0x21FF
+#define E2END  0x0FFF
+
+#endif // HOST_AVR_IO_H
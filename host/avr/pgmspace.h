@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * avr/pgmspace.h - Host stand-in for program memory access
+ *
+ * On the host everything lives in one address space, so PROGMEM is a no-op.
+ */
+
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+
+#define pgm_read_byte(a)        (*(const uint8_t*)(a))
+#define pgm_read_word(a)        (*(const uint16_t*)(a))
+#define pgm_read_dword(a)       (*(const uint32_t*)(a))
+#define pgm_read_float(a)       (*(const float*)(a))
+#define pgm_read_ptr(a)         (*(void* const*)(a))
+#define pgm_read_byte_near(a)   pgm_read_byte(a)
+#define pgm_read_word_near(a)   pgm_read_word(a)
+#define pgm_read_dword_near(a)  pgm_read_dword(a)
+#define pgm_read_float_near(a)  pgm_read_float(a)
+
+#define strlen_P  strlen
+#define strcpy_P  strcpy
+#define strncpy_P strncpy
+#define strcmp_P  strcmp
+#define strncmp_P strncmp
+#define strcat_P  strcat
+#define strchr_P  strchr
+#define strstr_P  strstr
+#define sprintf_P sprintf
+#define memcpy_P  memcpy
+
+typedef char prog_char;
+
+#endif // HOST_AVR_PGMSPACE_H
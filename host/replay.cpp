@@ -0,0 +1,506 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * replay.cpp - G-code replay benchmark for the host build
+ *
+ * Feeds a G-code file through GCodeParser::parse and Planner::buffer_line,
+ * running the stepper ISR in simulated time whenever the planner waits for
+ * buffer space. Reports planning throughput, steps emitted by the ISR and
+ * the simulated print time.
+ *
+ *   make host
+ *   host_build/marlin_host print.gcode
+ *
+ * With INPUT_SHAPING a second file name is taken for a CSV plot of the planned
+ * and the shaped X/Y position, sampled every millisecond of simulated time.
+ *
+ * Only motion and motion settings are handled: G0-G1, G5, G28, G90-G92,
+ * M82-M83, M201, M203-M205, M220, M593 and M930. Everything else is counted and skipped.
+ */
+
+// Standard headers first, before Arduino.h defines min() and max() as macros
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+#include "Marlin.h"
+#include "planner.h"
+#include "stepper.h"
+#include "temperature.h"
+#include "endstops.h"
+#include "gcode.h"
+
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  #include "planner_bezier.h"
+#endif
+
+#if ENABLED(ISR_STATISTICS)
+  #include "isr_stats.h"
+#endif
+
+#if ENABLED(FWRETRACT)
+  #include "fwretract.h"
+#endif
+
+#include "HAL_host.h"
+
+typedef std::chrono::steady_clock host_clock;
+
+// The stepper timer ISR, defined in stepper.cpp via ISR()
+extern "C" void TIMER1_COMPA_vect(void);
+
+//
+// State normally owned by Marlin_main.cpp
+//
+bool Running = true;
+uint8_t marlin_debug_flags = DEBUG_NONE;
+millis_t previous_cmd_ms;
+float feedrate_mm_s = MMM_TO_MMS(1500.0);
+int16_t feedrate_percentage = 100;
+bool axis_relative_modes[] = AXIS_RELATIVE_MODES;
+bool axis_known_position[XYZ] = { false }, axis_homed[XYZ] = { false };
+volatile bool wait_for_heatup = true;
+float current_position[XYZE] = { 0.0 }, destination[XYZE] = { 0.0 };
+uint8_t active_extruder = 0, target_extruder = 0;
+const char axis_codes[XYZE] = { 'X', 'Y', 'Z', 'E' };
+
+#if ENABLED(PRINTCOUNTER)
+  PrintCounter print_job_timer = PrintCounter();
+#else
+  Stopwatch print_job_timer = Stopwatch();
+#endif
+
+#if FAN_COUNT > 0
+  int16_t fanSpeeds[FAN_COUNT] = { 0 };
+#endif
+
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+  // Leveling is never activated by the replay
+  float bilinear_z_offset(const float raw[XYZ]) { UNUSED(raw); return 0.0; }
+#endif
+
+#if HAS_SOFTWARE_ENDSTOPS
+  // The replay has no homed machine to clamp against
+  bool soft_endstops_enabled = false;
+  void clamp_to_software_endstops(float target[XYZ]) { UNUSED(target); }
+#endif
+
+static bool relative_mode = false;
+
+//
+// Replay statistics
+//
+static uint32_t lines_read, commands_run, commands_skipped,
+                blocks_planned, isr_calls;
+static uint64_t steps_emitted[NUM_AXIS];
+static int32_t last_count[NUM_AXIS];
+static host_clock::duration isr_wall_time, plan_wall_time, plan_max_time;
+
+// The position of the steps actually taken. Shaped X and Y steps come later.
+static int32_t stepped_position(const AxisEnum axis) {
+  #if ENABLED(INPUT_SHAPING)
+    if (axis == X_AXIS || axis == Y_AXIS) return stepper.shaped_stepper_position(axis);
+  #endif
+  return stepper.position(axis);
+}
+
+// Resynchronize the step counter after the position is set directly
+static void sync_step_count() {
+  LOOP_XYZE(i) last_count[i] = stepped_position((AxisEnum)i);
+}
+
+#if ENABLED(INPUT_SHAPING)
+
+  static FILE *plot_file;
+  static uint64_t next_plot_ticks;
+  static float max_shaping_lag;
+
+  // X and Y (mm) from two stepper counts, as Stepper::get_axis_position_mm does it
+  static void counts_to_xy(const int32_t a, const int32_t b, float xy[2]) {
+    #if CORE_IS_XY
+      xy[X_AXIS] = 0.5f * (a + b) * planner.steps_to_mm[X_AXIS];
+      xy[Y_AXIS] = 0.5f * CORESIGN(a - b) * planner.steps_to_mm[Y_AXIS];
+    #else
+      xy[X_AXIS] = a * planner.steps_to_mm[X_AXIS];
+      xy[Y_AXIS] = b * planner.steps_to_mm[Y_AXIS];
+    #endif
+  }
+
+  // Compare the shaped position with the planned one every millisecond
+  static void sample_shaping() {
+    if (host_timer_ticks < next_plot_ticks) return;
+    next_plot_ticks = host_timer_ticks + (HOST_TIMER_RATE) / 1000;
+
+    float planned[2], shaped[2];
+    counts_to_xy(stepper.position(X_AXIS), stepper.position(Y_AXIS), planned);
+    counts_to_xy(stepper.shaped_stepper_position(X_AXIS), stepper.shaped_stepper_position(Y_AXIS), shaped);
+    const float lag = HYPOT(planned[X_AXIS] - shaped[X_AXIS], planned[Y_AXIS] - shaped[Y_AXIS]);
+    NOLESS(max_shaping_lag, lag);
+
+    if (plot_file)
+      fprintf(plot_file, "%.4f,%.4f,%.4f,%.4f,%.4f\n", double(host_timer_ticks) / (HOST_TIMER_RATE),
+        planned[X_AXIS], planned[Y_AXIS], shaped[X_AXIS], shaped[Y_AXIS]);
+  }
+
+#endif // INPUT_SHAPING
+
+// Run the stepper ISR once and advance simulated time by the period it scheduled
+static void run_stepper_isr() {
+  TIMER1_COMPA_vect();
+
+  ++isr_calls;
+  host_timer_ticks += OCR1A;
+
+  LOOP_XYZE(i) {
+    const int32_t count = stepped_position((AxisEnum)i);
+    steps_emitted[i] += labs(count - last_count[i]);
+    last_count[i] = count;
+  }
+
+  #if ENABLED(INPUT_SHAPING)
+    sample_shaping();
+  #endif
+}
+
+// Step until the current block is done (or for a while, if the stepper is stalled).
+// Timing the whole run keeps the clock overhead out of the planning time.
+static void run_stepper_block() {
+  const host_clock::time_point start = host_clock::now();
+  const uint8_t tail = planner.block_buffer_tail;
+  uint16_t calls = 0;
+  do {
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      stepper.prep_segments(); // As the main loop would between ISRs
+    #endif
+    run_stepper_isr();
+  } while (tail == planner.block_buffer_tail && planner.blocks_queued() && ++calls);
+  isr_wall_time += host_clock::now() - start;
+}
+
+// The planner calls idle() while it waits for a free block, so step in the meantime
+void idle(
+  #if ENABLED(ADVANCED_PAUSE_FEATURE)
+    bool no_stepper_sleep/*=false*/
+  #endif
+) {
+  run_stepper_block();
+}
+
+void manage_inactivity(bool ignore_stepper_queue/*=false*/) { UNUSED(ignore_stepper_queue); }
+
+void kill(const char* lcd_msg) {
+  fprintf(stderr, "kill: %s\n", lcd_msg);
+  exit(EXIT_FAILURE);
+}
+
+void enable_all_steppers() {}
+void disable_e_steppers() {}
+void disable_all_steppers() {}
+
+void quickstop_stepper() {
+  stepper.quick_stop();
+  stepper.synchronize();
+  sync_step_count();
+}
+
+//
+// Motion
+//
+static void plan_move() {
+  // Step until a block is free so the wait isn't charged to the planner
+  while (planner.is_full()) run_stepper_block();
+
+  const host_clock::time_point start = host_clock::now();
+  const host_clock::duration isr_before = isr_wall_time;
+  const uint8_t head_before = planner.block_buffer_head;
+
+  #if ENABLED(BEZIER_CURVE_SUPPORT)
+    if (parser.codenum == 5) {
+      const float offset[] = {
+        parser.linearval('I'), parser.linearval('J'),
+        parser.linearval('P'), parser.linearval('Q')
+      };
+      cubic_b_spline(current_position, destination, offset, MMS_SCALED(feedrate_mm_s), active_extruder);
+    }
+    else
+  #endif
+      planner.buffer_line_kinematic(destination, MMS_SCALED(feedrate_mm_s), active_extruder);
+
+  // Don't charge the planner for time spent stepping while the buffer was full
+  const host_clock::duration elapsed = (host_clock::now() - start) - (isr_wall_time - isr_before);
+  plan_wall_time += elapsed;
+  NOLESS(plan_max_time, elapsed);
+
+  blocks_planned += BLOCK_MOD(planner.block_buffer_head - head_before);
+
+  COPY(current_position, destination);
+}
+
+// Used by firmware retraction for its E and Z moves
+void prepare_move_to_destination() {
+  sync_step_count(); // Its position shifts move the step counts without stepping
+  plan_move();
+}
+
+static void get_destination() {
+  LOOP_XYZE(i) {
+    if (parser.seen(axis_codes[i]))
+      destination[i] = parser.value_axis_units((AxisEnum)i) + (axis_relative_modes[i] || relative_mode ? current_position[i] : 0);
+    else
+      destination[i] = current_position[i];
+  }
+  if (parser.linearval('F') > 0) feedrate_mm_s = MMM_TO_MMS(parser.value_feedrate());
+}
+
+static void set_current_position() {
+  stepper.synchronize();
+  planner.set_position_mm_kinematic(current_position);
+  sync_step_count();
+}
+
+static void process_parsed_command() {
+  switch (parser.command_letter) {
+    case 'G': switch (parser.codenum) {
+      case 0: case 1:
+      #if ENABLED(BEZIER_CURVE_SUPPORT)
+        case 5:
+      #endif
+        get_destination();
+        plan_move();
+        break;
+      case 28:
+        LOOP_XYZ(i) if (!parser.seen_axis() || parser.seen(axis_codes[i])) current_position[i] = 0.0;
+        set_current_position();
+        break;
+      #if ENABLED(FWRETRACT)
+        case 10: case 11:
+          fwretract.retract(parser.codenum == 10);
+          break;
+      #endif
+      case 90: relative_mode = false; break;
+      case 91: relative_mode = true; break;
+      case 92:
+        LOOP_XYZE(i) if (parser.seenval(axis_codes[i])) current_position[i] = parser.value_axis_units((AxisEnum)i);
+        set_current_position();
+        break;
+      default: ++commands_skipped; return;
+    } break;
+
+    case 'M': switch (parser.codenum) {
+      case 82: axis_relative_modes[E_AXIS] = false; break;
+      case 83: axis_relative_modes[E_AXIS] = true; break;
+      case 201:
+        LOOP_XYZE(i) if (parser.seen(axis_codes[i])) planner.max_acceleration_mm_per_s2[i] = parser.value_axis_units((AxisEnum)i);
+        planner.reset_acceleration_rates();
+        break;
+      case 203:
+        LOOP_XYZE(i) if (parser.seen(axis_codes[i])) planner.max_feedrate_mm_s[i] = parser.value_axis_units((AxisEnum)i);
+        break;
+      case 204:
+        if (parser.seen('S')) planner.travel_acceleration = planner.acceleration = parser.value_linear_units();
+        if (parser.seen('P')) planner.acceleration = parser.value_linear_units();
+        if (parser.seen('R')) planner.retract_acceleration = parser.value_linear_units();
+        if (parser.seen('T')) planner.travel_acceleration = parser.value_linear_units();
+        break;
+      case 205:
+        if (parser.seen('S')) planner.min_feedrate_mm_s = parser.value_linear_units();
+        if (parser.seen('T')) planner.min_travel_feedrate_mm_s = parser.value_linear_units();
+        if (parser.seen('B')) planner.min_segment_time_us = parser.value_ulong();
+        LOOP_XYZE(i) if (parser.seen(axis_codes[i])) planner.max_jerk[i] = parser.value_linear_units();
+        #if ENABLED(JUNCTION_DEVIATION)
+          planner.junction_deviation_M205();
+        #endif
+        break;
+      case 220:
+        if (parser.seenval('S')) feedrate_percentage = parser.value_int();
+        break;
+      #if ENABLED(INPUT_SHAPING)
+        case 593: gcode_M593(); break;
+      #endif
+      #if ENABLED(BLOCK_SYNC_EVENTS)
+        // State changes ride along with the moves instead of waiting for them
+        case 42: {
+          // PWM where the pin has it, as analogWrite would fall back to a digital write anyway
+          const int16_t pin = parser.intval('P', -1);
+          if (!WITHIN(pin, 0, 255) || !planner.add_sync_event(PWM_PINS(pin) ? SYNC_EVENT_PWM : SYNC_EVENT_PIN, pin, parser.byteval('S')))
+            fprintf(stderr, "M42 P%i: " MSG_ERR_PROTECTED_PIN "\n", pin);
+        } break;
+        case 104: planner.add_sync_event(SYNC_EVENT_HOTEND_TEMP, target_extruder, parser.celsiusval('S')); break;
+        case 140: planner.add_sync_event(SYNC_EVENT_BED_TEMP, 0, parser.celsiusval('S')); break;
+      #endif
+      case 931: planner.report_buffer(); break;
+      #if ENABLED(ISR_STATISTICS)
+        case 930: stepper.synchronize(); gcode_M930(); break; // Report on the moves so far
+      #endif
+      default: ++commands_skipped; return;
+    } break;
+
+    default: ++commands_skipped; return;
+  }
+  ++commands_run;
+}
+
+/**
+ * Apply the planner defaults from Configuration.h,
+ * as MarlinSettings::reset() does on the printer.
+ */
+static void reset_planner_settings() {
+  const float tmp1[] = DEFAULT_AXIS_STEPS_PER_UNIT, tmp2[] = DEFAULT_MAX_FEEDRATE;
+  const uint32_t tmp3[] = DEFAULT_MAX_ACCELERATION;
+  LOOP_XYZE_N(i) {
+    planner.axis_steps_per_mm[i] = tmp1[i < COUNT(tmp1) ? i : COUNT(tmp1) - 1];
+    planner.max_feedrate_mm_s[i] = tmp2[i < COUNT(tmp2) ? i : COUNT(tmp2) - 1];
+    planner.max_acceleration_mm_per_s2[i] = tmp3[i < COUNT(tmp3) ? i : COUNT(tmp3) - 1];
+  }
+  planner.acceleration = DEFAULT_ACCELERATION;
+  planner.retract_acceleration = DEFAULT_RETRACT_ACCELERATION;
+  planner.travel_acceleration = DEFAULT_TRAVEL_ACCELERATION;
+  planner.min_feedrate_mm_s = DEFAULT_MINIMUMFEEDRATE;
+  planner.min_segment_time_us = DEFAULT_MINSEGMENTTIME;
+  planner.min_travel_feedrate_mm_s = DEFAULT_MINTRAVELFEEDRATE;
+  planner.max_jerk[X_AXIS] = DEFAULT_XJERK;
+  planner.max_jerk[Y_AXIS] = DEFAULT_YJERK;
+  planner.max_jerk[Z_AXIS] = DEFAULT_ZJERK;
+  planner.max_jerk[E_AXIS] = DEFAULT_EJERK;
+  #if ENABLED(JUNCTION_DEVIATION)
+    planner.junction_deviation_mm = float(JUNCTION_DEVIATION_MM);
+  #endif
+  #if ENABLED(LIN_ADVANCE)
+    planner.extruder_advance_k = LIN_ADVANCE_K;
+    planner.advance_ed_ratio = LIN_ADVANCE_E_D_RATIO;
+  #endif
+  #if ENABLED(INPUT_SHAPING)
+    stepper.shaping_frequency[X_AXIS] = SHAPING_FREQ_X;
+    stepper.shaping_frequency[Y_AXIS] = SHAPING_FREQ_Y;
+    stepper.shaping_zeta[X_AXIS] = SHAPING_ZETA_X;
+    stepper.shaping_zeta[Y_AXIS] = SHAPING_ZETA_Y;
+    stepper.refresh_shaping();
+  #endif
+  planner.refresh_positioning();
+}
+
+static double to_us(const host_clock::duration d) {
+  return std::chrono::duration<double, std::micro>(d).count();
+}
+
+static void report() {
+  const double plan_us = to_us(plan_wall_time),
+               sim_s = double(host_timer_ticks) / (HOST_TIMER_RATE);
+  const uint32_t sim_secs = sim_s;
+
+  printf("\nLines read:            %u (%u run, %u skipped)\n", lines_read, commands_run, commands_skipped);
+  printf("Blocks planned:        %u\n", blocks_planned);
+  printf("Planning time:         %.3f ms total", plan_us / 1000.0);
+  if (blocks_planned)
+    printf(", %.3f us/block avg, %.3f us max, %.0f blocks/s", plan_us / blocks_planned, to_us(plan_max_time), blocks_planned * 1e6 / plan_us);
+  printf("\nStepper ISR calls:     %u (%.3f ms wall)\n", isr_calls, to_us(isr_wall_time) / 1000.0);
+  printf("Steps emitted:        ");
+  LOOP_XYZE(i) printf(" %c%llu", axis_codes[i], (unsigned long long)steps_emitted[i]);
+  printf("\nSimulated print time:  %.3f s (%uh %02um %02us)\n", sim_s, sim_secs / 3600, (sim_secs / 60) % 60, sim_secs % 60);
+  #if ENABLED(INPUT_SHAPING)
+    printf("Max shaping lag:       %.3f mm\n", max_shaping_lag);
+  #endif
+}
+
+int main(int argc, char *argv[]) {
+  #if ENABLED(INPUT_SHAPING)
+    if (argc != 2 && argc != 3) {
+      fprintf(stderr, "Usage: %s <file.gcode> [shaping.csv]\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  #else
+    if (argc != 2) {
+      fprintf(stderr, "Usage: %s <file.gcode>\n", argv[0]);
+      return EXIT_FAILURE;
+    }
+  #endif
+
+  FILE *f = fopen(argv[1], "r");
+  if (!f) {
+    perror(argv[1]);
+    return EXIT_FAILURE;
+  }
+
+  #if ENABLED(INPUT_SHAPING)
+    if (argc == 3) {
+      plot_file = fopen(argv[2], "w");
+      if (!plot_file) {
+        perror(argv[2]);
+        return EXIT_FAILURE;
+      }
+      fputs("time,planned_x,planned_y,shaped_x,shaped_y\n", plot_file);
+    }
+  #endif
+
+  reset_planner_settings();
+  stepper.init();
+  sync_step_count();
+
+  // There are no switches or heaters, so don't check endstops or hotend temperature
+  endstops.enable_globally(false);
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    thermalManager.allow_cold_extrude = true;
+  #endif
+
+  char line[256];
+  while (fgets(line, sizeof(line), f)) {
+    ++lines_read;
+
+    // Strip comments and trailing whitespace, like the serial reader does
+    char *p = strchr(line, ';');
+    if (p) *p = '\0';
+    for (p = line + strlen(line); p > line && (p[-1] == '\n' || p[-1] == '\r' || p[-1] == ' ' || p[-1] == '\t');) *--p = '\0';
+    if (!*line) continue;
+
+    parser.parse(line);
+    process_parsed_command();
+
+    // As check_axes_activity() does in the main loop
+    #if ENABLED(SEGMENT_MERGE)
+      if (planner.movesplanned() < 2) planner.flush_merged_segment();
+    #endif
+    #if ENABLED(BLOCK_SYNC_EVENTS)
+      planner.apply_sync_events();
+    #endif
+  }
+  fclose(f);
+
+  // Run out the remaining moves
+  #if ENABLED(SEGMENT_MERGE)
+    planner.flush_merged_segment();
+  #endif
+  while (planner.blocks_queued() || stepper.current_block) run_stepper_block();
+  #if ENABLED(INPUT_SHAPING)
+    while (stepper.shaping_busy()) run_stepper_block(); // The last delayed impulses
+  #endif
+  #if ENABLED(BLOCK_SYNC_EVENTS)
+    planner.apply_sync_events();
+  #endif
+
+  #if ENABLED(INPUT_SHAPING)
+    if (plot_file) fclose(plot_file);
+  #endif
+
+  report();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,41 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Version.h - Host stand-in for the build version strings
+ */
+
+#ifndef HOST_VERSION_H
+#define HOST_VERSION_H
+
+#define SHORT_BUILD_VERSION "1.1.8"
+#define DETAILED_BUILD_VERSION SHORT_BUILD_VERSION " (Github)"
+#define STRING_DISTRIBUTION_DATE "2017-12-25 12:00"
+#define REQUIRED_CONFIGURATION_H_VERSION 010107
+#define REQUIRED_CONFIGURATION_ADV_H_VERSION 010107
+#define PROTOCOL_VERSION "1.0"
+#define MACHINE_NAME "3D Printer"
+#define SOURCE_CODE_URL "https://github.com/MarlinFirmware/Marlin"
+#define DEFAULT_MACHINE_UUID "cede2a2f-41a2-4748-9b12-c55c62f367ff"
+#define WEBSITE_URL "http://marlinfw.org"
+
+#endif // HOST_VERSION_H
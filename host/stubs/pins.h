@@ -0,0 +1,199 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * pins.h - Host stand-in for the board pin definitions
+ */
+
+#ifndef HOST_PINS_H
+#define HOST_PINS_H
+
+// The harness always simulates RAMPS 1.4 (EFB) pins, whatever MOTHERBOARD says
+#define BOARD_NAME "RAMPS 1.4"
+#define IS_RAMPS_EFB
+#define X_STEP_PIN         54
+#define X_DIR_PIN          55
+#define X_ENABLE_PIN       38
+#define X_MIN_PIN           3
+#define X_MAX_PIN           2
+#define Y_STEP_PIN         60
+#define Y_DIR_PIN          61
+#define Y_ENABLE_PIN       56
+#define Y_MIN_PIN          14
+#define Y_MAX_PIN          15
+#define Z_STEP_PIN         46
+#define Z_DIR_PIN          48
+#define Z_ENABLE_PIN       62
+#define Z_MIN_PIN          18
+#define Z_MAX_PIN          19
+#define E0_STEP_PIN        26
+#define E0_DIR_PIN         28
+#define E0_ENABLE_PIN      24
+#define E1_STEP_PIN        36
+#define E1_DIR_PIN         34
+#define E1_ENABLE_PIN      30
+#define TEMP_0_PIN         13
+#define TEMP_1_PIN         15
+#define TEMP_BED_PIN       14
+#define HEATER_0_PIN       10
+#define HEATER_BED_PIN      8
+#define FAN_PIN             9
+#define SDSS               53
+#define LED_PIN            13
+#define PS_ON_PIN          12
+#define KILL_PIN           -1
+#define SERVO0_PIN         11
+
+#ifndef X_MS1_PIN
+  #define X_MS1_PIN -1
+#endif
+#ifndef X_MS2_PIN
+  #define X_MS2_PIN -1
+#endif
+#ifndef Y_MS1_PIN
+  #define Y_MS1_PIN -1
+#endif
+#ifndef Y_MS2_PIN
+  #define Y_MS2_PIN -1
+#endif
+#ifndef Z_MS1_PIN
+  #define Z_MS1_PIN -1
+#endif
+#ifndef Z_MS2_PIN
+  #define Z_MS2_PIN -1
+#endif
+#ifndef E0_MS1_PIN
+  #define E0_MS1_PIN -1
+#endif
+#ifndef E0_MS2_PIN
+  #define E0_MS2_PIN -1
+#endif
+#ifndef E1_MS1_PIN
+  #define E1_MS1_PIN -1
+#endif
+#ifndef E1_MS2_PIN
+  #define E1_MS2_PIN -1
+#endif
+#ifndef E2_MS1_PIN
+  #define E2_MS1_PIN -1
+#endif
+#ifndef E2_MS2_PIN
+  #define E2_MS2_PIN -1
+#endif
+#ifndef E3_MS1_PIN
+  #define E3_MS1_PIN -1
+#endif
+#ifndef E3_MS2_PIN
+  #define E3_MS2_PIN -1
+#endif
+#ifndef E4_MS1_PIN
+  #define E4_MS1_PIN -1
+#endif
+#ifndef E4_MS2_PIN
+  #define E4_MS2_PIN -1
+#endif
+#ifndef E0_CS_PIN
+  #define E0_CS_PIN -1
+#endif
+#ifndef E1_CS_PIN
+  #define E1_CS_PIN -1
+#endif
+#ifndef E2_CS_PIN
+  #define E2_CS_PIN -1
+#endif
+#ifndef E3_CS_PIN
+  #define E3_CS_PIN -1
+#endif
+#ifndef E4_CS_PIN
+  #define E4_CS_PIN -1
+#endif
+#ifndef FAN_PIN
+  #define FAN_PIN -1
+#endif
+#define FAN1_PIN -1
+#define FAN2_PIN -1
+#ifndef HEATER_1_PIN
+  #define HEATER_1_PIN -1
+#endif
+#ifndef HEATER_2_PIN
+  #define HEATER_2_PIN -1
+#endif
+#ifndef HEATER_3_PIN
+  #define HEATER_3_PIN -1
+#endif
+#ifndef HEATER_4_PIN
+  #define HEATER_4_PIN -1
+#endif
+#ifndef TEMP_2_PIN
+  #define TEMP_2_PIN -1
+#endif
+#ifndef TEMP_3_PIN
+  #define TEMP_3_PIN -1
+#endif
+#ifndef TEMP_4_PIN
+  #define TEMP_4_PIN -1
+#endif
+#ifndef SD_DETECT_PIN
+  #define SD_DETECT_PIN -1
+#endif
+#ifndef SDPOWER
+  #define SDPOWER -1
+#endif
+#ifndef SUICIDE_PIN
+  #define SUICIDE_PIN -1
+#endif
+#ifndef Z_MIN_PROBE_PIN
+  #define Z_MIN_PROBE_PIN -1
+#endif
+#ifndef LCD_PINS_RS
+  #define LCD_PINS_RS -1
+#endif
+#ifndef MAX6675_SS
+  #define MAX6675_SS -1
+#endif
+#ifndef CONTROLLER_FAN_PIN
+  #define CONTROLLER_FAN_PIN -1
+#endif
+#ifndef FILWIDTH_PIN
+  #define FILWIDTH_PIN -1
+#endif
+#ifndef MAX_EXTRUDERS
+  #define MAX_EXTRUDERS 5
+#endif
+#define X2_STEP_PIN -1
+#define X2_DIR_PIN -1
+#define X2_ENABLE_PIN -1
+#define Y2_STEP_PIN -1
+#define Y2_DIR_PIN -1
+#define Y2_ENABLE_PIN -1
+#define Z2_STEP_PIN -1
+#define Z2_DIR_PIN -1
+#define Z2_ENABLE_PIN -1
+// Serial, steppers, endstops, heaters and thermistors (A13-A15), as M42 guards them
+#define SENSITIVE_PINS { 0, 1, \
+  X_STEP_PIN, X_DIR_PIN, X_ENABLE_PIN, X_MIN_PIN, X_MAX_PIN, \
+  Y_STEP_PIN, Y_DIR_PIN, Y_ENABLE_PIN, Y_MIN_PIN, Y_MAX_PIN, \
+  Z_STEP_PIN, Z_DIR_PIN, Z_ENABLE_PIN, Z_MIN_PIN, Z_MAX_PIN, \
+  E0_STEP_PIN, E0_DIR_PIN, E0_ENABLE_PIN, E1_STEP_PIN, E1_DIR_PIN, E1_ENABLE_PIN, \
+  HEATER_0_PIN, HEATER_BED_PIN, 67, 68, 69 }
+
+#endif // HOST_PINS_H
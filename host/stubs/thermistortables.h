@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * thermistortables.h - Host stand-in for the thermistor tables. Hotend 0 and the bed use table 5.
+ */
+
+#ifndef HOST_THERMISTORTABLES_H
+#define HOST_THERMISTORTABLES_H
+
+#include "Marlin.h"
+
+#define OVERSAMPLENR 16
+#define OV(N) int16_t((N) * (OVERSAMPLENR))
+
+#include "thermistortable_5.h"
+
+#define HEATER_0_TEMPTABLE temptable_5
+#define HEATER_0_TEMPTABLE_LEN COUNT(temptable_5)
+#define BEDTEMPTABLE temptable_5
+#define BEDTEMPTABLE_LEN COUNT(temptable_5)
+
+#define HEATER_1_TEMPTABLE NULL
+#define HEATER_2_TEMPTABLE NULL
+#define HEATER_3_TEMPTABLE NULL
+#define HEATER_4_TEMPTABLE NULL
+#define HEATER_1_TEMPTABLE_LEN 0
+#define HEATER_2_TEMPTABLE_LEN 0
+#define HEATER_3_TEMPTABLE_LEN 0
+#define HEATER_4_TEMPTABLE_LEN 0
+
+// Table 5 runs from high to low ADC values
+#define HEATER_0_RAW_HI_TEMP 0
+#define HEATER_0_RAW_LO_TEMP 16383
+#define HEATER_1_RAW_HI_TEMP 16383
+#define HEATER_1_RAW_LO_TEMP 0
+#define HEATER_2_RAW_HI_TEMP 16383
+#define HEATER_2_RAW_LO_TEMP 0
+#define HEATER_3_RAW_HI_TEMP 16383
+#define HEATER_3_RAW_LO_TEMP 0
+#define HEATER_4_RAW_HI_TEMP 16383
+#define HEATER_4_RAW_LO_TEMP 0
+#define HEATER_BED_RAW_HI_TEMP 0
+#define HEATER_BED_RAW_LO_TEMP 16383
+
+#endif // HOST_THERMISTORTABLES_H
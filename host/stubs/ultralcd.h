@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * ultralcd.h - Host stand-in for the LCD. Status messages go nowhere.
+ */
+
+#ifndef HOST_ULTRALCD_H
+#define HOST_ULTRALCD_H
+
+#include "Marlin.h"
+
+inline void lcd_update() {}
+inline void lcd_init() {}
+inline bool lcd_hasstatus() { return false; }
+inline void lcd_setstatus(const char*, const bool=false) {}
+inline void lcd_setstatusPGM(const char*, const int8_t=0) {}
+inline void lcd_setalertstatusPGM(const char*) {}
+inline void lcd_reset_alert_level() {}
+inline void lcd_reset_status() {}
+inline bool lcd_detected() { return true; }
+inline void lcd_refresh() {}
+inline void lcd_buzz(const long, const uint16_t) {}
+inline void lcd_quick_feedback() {}
+inline void lcd_buttons_update() {}
+inline void lcd_status_printf_P(const uint8_t, const char * const, ...) {}
+
+#define LCD_MESSAGEPGM(x) lcd_setstatusPGM(PSTR(x))
+#define LCD_ALERTMESSAGEPGM(x) lcd_setalertstatusPGM(PSTR(x))
+
+extern int16_t lcd_preheat_hotend_temp[2], lcd_preheat_bed_temp[2], lcd_preheat_fan_speed[2];
+
+#endif // HOST_ULTRALCD_H
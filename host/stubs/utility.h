@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * utility.h - Host stand-in for the string and delay helpers
+ */
+
+#ifndef HOST_UTILITY_H
+#define HOST_UTILITY_H
+
+void safe_delay(millis_t ms);
+char* itostr3(const int &x);
+char* ftostr32(const float &x);
+char* ftostr43sign(const float &x, char plus=' ');
+char* ftostr52sign(const float &x);
+char* ftostr62rj(const float &x);
+char* ftostr3(const float &x);
+char* ftostr31ns(const float &x);
+char* i16tostr3left(const int16_t x);
+inline void serial_delay(const millis_t) {}
+void crc16(uint16_t *crc, const void * const data, uint16_t cnt);
+
+#endif // HOST_UTILITY_H
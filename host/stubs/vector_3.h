@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * vector_3.h - Host stand-in for the leveling vector math
+ */
+
+#ifndef HOST_VECTOR_3_H
+#define HOST_VECTOR_3_H
+
+struct vector_3 {
+  float x, y, z;
+  vector_3() {}
+  vector_3(float a, float b, float c) : x(a), y(b), z(c) {}
+};
+
+struct matrix_3x3 {
+  float matrix[9];
+  void set_to_identity();
+  static matrix_3x3 transpose(matrix_3x3);
+  void debug(const char*);
+};
+
+void apply_rotation_xyz(matrix_3x3 rotationMatrix, float &x, float &y, float &z);
+
+#endif // HOST_VECTOR_3_H
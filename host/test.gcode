@@ -0,0 +1,1121 @@
+G28
+G90
+M82
+G92 E0
+G1 Z0.2 F3000
+G1 X140.000 Y100.000 E0.0500 F3600
+G1 X139.994 Y100.698 E0.1000 F3600
+G1 X139.976 Y101.396 E0.1500 F3600
+G1 X139.945 Y102.093 E0.2000 F3600
+G1 X139.903 Y102.790 E0.2500 F3600
+G1 X139.848 Y103.486 E0.3000 F3600
+G1 X139.781 Y104.181 E0.3500 F3600
+G1 X139.702 Y104.875 E0.4000 F3600
+G1 X139.611 Y105.567 E0.4500 F3600
+G1 X139.508 Y106.257 E0.5000 F3600
+G1 X139.392 Y106.946 E0.5500 F3600
+G1 X139.265 Y107.632 E0.6000 F3600
+G1 X139.126 Y108.316 E0.6500 F3600
+G1 X138.975 Y108.998 E0.7000 F3600
+G1 X138.812 Y109.677 E0.7500 F3600
+G1 X138.637 Y110.353 E0.8000 F3600
+G1 X138.450 Y111.025 E0.8500 F3600
+G1 X138.252 Y111.695 E0.9000 F3600
+G1 X138.042 Y112.361 E0.9500 F3600
+G1 X137.821 Y113.023 E1.0000 F3600
+G1 X137.588 Y113.681 E1.0500 F3600
+G1 X137.343 Y114.335 E1.1000 F3600
+G1 X137.087 Y114.984 E1.1500 F3600
+G1 X136.820 Y115.629 E1.2000 F3600
+G1 X136.542 Y116.269 E1.2500 F3600
+G1 X136.252 Y116.905 E1.3000 F3600
+G1 X135.952 Y117.535 E1.3500 F3600
+G1 X135.640 Y118.160 E1.4000 F3600
+G1 X135.318 Y118.779 E1.4500 F3600
+G1 X134.985 Y119.392 E1.5000 F3600
+G1 X134.641 Y120.000 E1.5500 F3600
+G1 X134.287 Y120.602 E1.6000 F3600
+G1 X133.922 Y121.197 E1.6500 F3600
+G1 X133.547 Y121.786 E1.7000 F3600
+G1 X133.162 Y122.368 E1.7500 F3600
+G1 X132.766 Y122.943 E1.8000 F3600
+G1 X132.361 Y123.511 E1.8500 F3600
+G1 X131.945 Y124.073 E1.9000 F3600
+G1 X131.520 Y124.626 E1.9500 F3600
+G1 X131.086 Y125.173 E2.0000 F3600
+G1 X130.642 Y125.712 E2.0500 F3600
+G1 X130.188 Y126.242 E2.1000 F3600
+G1 X129.726 Y126.765 E2.1500 F3600
+G1 X129.254 Y127.280 E2.2000 F3600
+G1 X128.774 Y127.786 E2.2500 F3600
+G1 X128.284 Y128.284 E2.3000 F3600
+G1 X127.786 Y128.774 E2.3500 F3600
+G1 X127.280 Y129.254 E2.4000 F3600
+G1 X126.765 Y129.726 E2.4500 F3600
+G1 X126.242 Y130.188 E2.5000 F3600
+G1 X125.712 Y130.642 E2.5500 F3600
+G1 X125.173 Y131.086 E2.6000 F3600
+G1 X124.626 Y131.520 E2.6500 F3600
+G1 X124.073 Y131.945 E2.7000 F3600
+G1 X123.511 Y132.361 E2.7500 F3600
+G1 X122.943 Y132.766 E2.8000 F3600
+G1 X122.368 Y133.162 E2.8500 F3600
+G1 X121.786 Y133.547 E2.9000 F3600
+G1 X121.197 Y133.922 E2.9500 F3600
+G1 X120.602 Y134.287 E3.0000 F3600
+G1 X120.000 Y134.641 E3.0500 F3600
+G1 X119.392 Y134.985 E3.1000 F3600
+G1 X118.779 Y135.318 E3.1500 F3600
+G1 X118.160 Y135.640 E3.2000 F3600
+G1 X117.535 Y135.952 E3.2500 F3600
+G1 X116.905 Y136.252 E3.3000 F3600
+G1 X116.269 Y136.542 E3.3500 F3600
+G1 X115.629 Y136.820 E3.4000 F3600
+G1 X114.984 Y137.087 E3.4500 F3600
+G1 X114.335 Y137.343 E3.5000 F3600
+G1 X113.681 Y137.588 E3.5500 F3600
+G1 X113.023 Y137.821 E3.6000 F3600
+G1 X112.361 Y138.042 E3.6500 F3600
+G1 X111.695 Y138.252 E3.7000 F3600
+G1 X111.025 Y138.450 E3.7500 F3600
+G1 X110.353 Y138.637 E3.8000 F3600
+G1 X109.677 Y138.812 E3.8500 F3600
+G1 X108.998 Y138.975 E3.9000 F3600
+G1 X108.316 Y139.126 E3.9500 F3600
+G1 X107.632 Y139.265 E4.0000 F3600
+G1 X106.946 Y139.392 E4.0500 F3600
+G1 X106.257 Y139.508 E4.1000 F3600
+G1 X105.567 Y139.611 E4.1500 F3600
+G1 X104.875 Y139.702 E4.2000 F3600
+G1 X104.181 Y139.781 E4.2500 F3600
+G1 X103.486 Y139.848 E4.3000 F3600
+G1 X102.790 Y139.903 E4.3500 F3600
+G1 X102.093 Y139.945 E4.4000 F3600
+G1 X101.396 Y139.976 E4.4500 F3600
+G1 X100.698 Y139.994 E4.5000 F3600
+G1 X100.000 Y140.000 E4.5500 F3600
+G1 X99.302 Y139.994 E4.6000 F3600
+G1 X98.604 Y139.976 E4.6500 F3600
+G1 X97.907 Y139.945 E4.7000 F3600
+G1 X97.210 Y139.903 E4.7500 F3600
+G1 X96.514 Y139.848 E4.8000 F3600
+G1 X95.819 Y139.781 E4.8500 F3600
+G1 X95.125 Y139.702 E4.9000 F3600
+G1 X94.433 Y139.611 E4.9500 F3600
+G1 X93.743 Y139.508 E5.0000 F3600
+G1 X93.054 Y139.392 E5.0500 F3600
+G1 X92.368 Y139.265 E5.1000 F3600
+G1 X91.684 Y139.126 E5.1500 F3600
+G1 X91.002 Y138.975 E5.2000 F3600
+G1 X90.323 Y138.812 E5.2500 F3600
+G1 X89.647 Y138.637 E5.3000 F3600
+G1 X88.975 Y138.450 E5.3500 F3600
+G1 X88.305 Y138.252 E5.4000 F3600
+G1 X87.639 Y138.042 E5.4500 F3600
+G1 X86.977 Y137.821 E5.5000 F3600
+G1 X86.319 Y137.588 E5.5500 F3600
+G1 X85.665 Y137.343 E5.6000 F3600
+G1 X85.016 Y137.087 E5.6500 F3600
+G1 X84.371 Y136.820 E5.7000 F3600
+G1 X83.731 Y136.542 E5.7500 F3600
+G1 X83.095 Y136.252 E5.8000 F3600
+G1 X82.465 Y135.952 E5.8500 F3600
+G1 X81.840 Y135.640 E5.9000 F3600
+G1 X81.221 Y135.318 E5.9500 F3600
+G1 X80.608 Y134.985 E6.0000 F3600
+G1 X80.000 Y134.641 E6.0500 F3600
+G1 X79.398 Y134.287 E6.1000 F3600
+G1 X78.803 Y133.922 E6.1500 F3600
+G1 X78.214 Y133.547 E6.2000 F3600
+G1 X77.632 Y133.162 E6.2500 F3600
+G1 X77.057 Y132.766 E6.3000 F3600
+G1 X76.489 Y132.361 E6.3500 F3600
+G1 X75.927 Y131.945 E6.4000 F3600
+G1 X75.374 Y131.520 E6.4500 F3600
+G1 X74.827 Y131.086 E6.5000 F3600
+G1 X74.288 Y130.642 E6.5500 F3600
+G1 X73.758 Y130.188 E6.6000 F3600
+G1 X73.235 Y129.726 E6.6500 F3600
+G1 X72.720 Y129.254 E6.7000 F3600
+G1 X72.214 Y128.774 E6.7500 F3600
+G1 X71.716 Y128.284 E6.8000 F3600
+G1 X71.226 Y127.786 E6.8500 F3600
+G1 X70.746 Y127.280 E6.9000 F3600
+G1 X70.274 Y126.765 E6.9500 F3600
+G1 X69.812 Y126.242 E7.0000 F3600
+G1 X69.358 Y125.712 E7.0500 F3600
+G1 X68.914 Y125.173 E7.1000 F3600
+G1 X68.480 Y124.626 E7.1500 F3600
+G1 X68.055 Y124.073 E7.2000 F3600
+G1 X67.639 Y123.511 E7.2500 F3600
+G1 X67.234 Y122.943 E7.3000 F3600
+G1 X66.838 Y122.368 E7.3500 F3600
+G1 X66.453 Y121.786 E7.4000 F3600
+G1 X66.078 Y121.197 E7.4500 F3600
+G1 X65.713 Y120.602 E7.5000 F3600
+G1 X65.359 Y120.000 E7.5500 F3600
+G1 X65.015 Y119.392 E7.6000 F3600
+G1 X64.682 Y118.779 E7.6500 F3600
+G1 X64.360 Y118.160 E7.7000 F3600
+G1 X64.048 Y117.535 E7.7500 F3600
+G1 X63.748 Y116.905 E7.8000 F3600
+G1 X63.458 Y116.269 E7.8500 F3600
+G1 X63.180 Y115.629 E7.9000 F3600
+G1 X62.913 Y114.984 E7.9500 F3600
+G1 X62.657 Y114.335 E8.0000 F3600
+G1 X62.412 Y113.681 E8.0500 F3600
+G1 X62.179 Y113.023 E8.1000 F3600
+G1 X61.958 Y112.361 E8.1500 F3600
+G1 X61.748 Y111.695 E8.2000 F3600
+G1 X61.550 Y111.025 E8.2500 F3600
+G1 X61.363 Y110.353 E8.3000 F3600
+G1 X61.188 Y109.677 E8.3500 F3600
+G1 X61.025 Y108.998 E8.4000 F3600
+G1 X60.874 Y108.316 E8.4500 F3600
+G1 X60.735 Y107.632 E8.5000 F3600
+G1 X60.608 Y106.946 E8.5500 F3600
+G1 X60.492 Y106.257 E8.6000 F3600
+G1 X60.389 Y105.567 E8.6500 F3600
+G1 X60.298 Y104.875 E8.7000 F3600
+G1 X60.219 Y104.181 E8.7500 F3600
+G1 X60.152 Y103.486 E8.8000 F3600
+G1 X60.097 Y102.790 E8.8500 F3600
+G1 X60.055 Y102.093 E8.9000 F3600
+G1 X60.024 Y101.396 E8.9500 F3600
+G1 X60.006 Y100.698 E9.0000 F3600
+G1 X60.000 Y100.000 E9.0500 F3600
+G1 X60.006 Y99.302 E9.1000 F3600
+G1 X60.024 Y98.604 E9.1500 F3600
+G1 X60.055 Y97.907 E9.2000 F3600
+G1 X60.097 Y97.210 E9.2500 F3600
+G1 X60.152 Y96.514 E9.3000 F3600
+G1 X60.219 Y95.819 E9.3500 F3600
+G1 X60.298 Y95.125 E9.4000 F3600
+G1 X60.389 Y94.433 E9.4500 F3600
+G1 X60.492 Y93.743 E9.5000 F3600
+G1 X60.608 Y93.054 E9.5500 F3600
+G1 X60.735 Y92.368 E9.6000 F3600
+G1 X60.874 Y91.684 E9.6500 F3600
+G1 X61.025 Y91.002 E9.7000 F3600
+G1 X61.188 Y90.323 E9.7500 F3600
+G1 X61.363 Y89.647 E9.8000 F3600
+G1 X61.550 Y88.975 E9.8500 F3600
+G1 X61.748 Y88.305 E9.9000 F3600
+G1 X61.958 Y87.639 E9.9500 F3600
+G1 X62.179 Y86.977 E10.0000 F3600
+G1 X62.412 Y86.319 E10.0500 F3600
+G1 X62.657 Y85.665 E10.1000 F3600
+G1 X62.913 Y85.016 E10.1500 F3600
+G1 X63.180 Y84.371 E10.2000 F3600
+G1 X63.458 Y83.731 E10.2500 F3600
+G1 X63.748 Y83.095 E10.3000 F3600
+G1 X64.048 Y82.465 E10.3500 F3600
+G1 X64.360 Y81.840 E10.4000 F3600
+G1 X64.682 Y81.221 E10.4500 F3600
+G1 X65.015 Y80.608 E10.5000 F3600
+G1 X65.359 Y80.000 E10.5500 F3600
+G1 X65.713 Y79.398 E10.6000 F3600
+G1 X66.078 Y78.803 E10.6500 F3600
+G1 X66.453 Y78.214 E10.7000 F3600
+G1 X66.838 Y77.632 E10.7500 F3600
+G1 X67.234 Y77.057 E10.8000 F3600
+G1 X67.639 Y76.489 E10.8500 F3600
+G1 X68.055 Y75.927 E10.9000 F3600
+G1 X68.480 Y75.374 E10.9500 F3600
+G1 X68.914 Y74.827 E11.0000 F3600
+G1 X69.358 Y74.288 E11.0500 F3600
+G1 X69.812 Y73.758 E11.1000 F3600
+G1 X70.274 Y73.235 E11.1500 F3600
+G1 X70.746 Y72.720 E11.2000 F3600
+G1 X71.226 Y72.214 E11.2500 F3600
+G1 X71.716 Y71.716 E11.3000 F3600
+G1 X72.214 Y71.226 E11.3500 F3600
+G1 X72.720 Y70.746 E11.4000 F3600
+G1 X73.235 Y70.274 E11.4500 F3600
+G1 X73.758 Y69.812 E11.5000 F3600
+G1 X74.288 Y69.358 E11.5500 F3600
+G1 X74.827 Y68.914 E11.6000 F3600
+G1 X75.374 Y68.480 E11.6500 F3600
+G1 X75.927 Y68.055 E11.7000 F3600
+G1 X76.489 Y67.639 E11.7500 F3600
+G1 X77.057 Y67.234 E11.8000 F3600
+G1 X77.632 Y66.838 E11.8500 F3600
+G1 X78.214 Y66.453 E11.9000 F3600
+G1 X78.803 Y66.078 E11.9500 F3600
+G1 X79.398 Y65.713 E12.0000 F3600
+G1 X80.000 Y65.359 E12.0500 F3600
+G1 X80.608 Y65.015 E12.1000 F3600
+G1 X81.221 Y64.682 E12.1500 F3600
+G1 X81.840 Y64.360 E12.2000 F3600
+G1 X82.465 Y64.048 E12.2500 F3600
+G1 X83.095 Y63.748 E12.3000 F3600
+G1 X83.731 Y63.458 E12.3500 F3600
+G1 X84.371 Y63.180 E12.4000 F3600
+G1 X85.016 Y62.913 E12.4500 F3600
+G1 X85.665 Y62.657 E12.5000 F3600
+G1 X86.319 Y62.412 E12.5500 F3600
+G1 X86.977 Y62.179 E12.6000 F3600
+G1 X87.639 Y61.958 E12.6500 F3600
+G1 X88.305 Y61.748 E12.7000 F3600
+G1 X88.975 Y61.550 E12.7500 F3600
+G1 X89.647 Y61.363 E12.8000 F3600
+G1 X90.323 Y61.188 E12.8500 F3600
+G1 X91.002 Y61.025 E12.9000 F3600
+G1 X91.684 Y60.874 E12.9500 F3600
+G1 X92.368 Y60.735 E13.0000 F3600
+G1 X93.054 Y60.608 E13.0500 F3600
+G1 X93.743 Y60.492 E13.1000 F3600
+G1 X94.433 Y60.389 E13.1500 F3600
+G1 X95.125 Y60.298 E13.2000 F3600
+G1 X95.819 Y60.219 E13.2500 F3600
+G1 X96.514 Y60.152 E13.3000 F3600
+G1 X97.210 Y60.097 E13.3500 F3600
+G1 X97.907 Y60.055 E13.4000 F3600
+G1 X98.604 Y60.024 E13.4500 F3600
+G1 X99.302 Y60.006 E13.5000 F3600
+G1 X100.000 Y60.000 E13.5500 F3600
+G1 X100.698 Y60.006 E13.6000 F3600
+G1 X101.396 Y60.024 E13.6500 F3600
+G1 X102.093 Y60.055 E13.7000 F3600
+G1 X102.790 Y60.097 E13.7500 F3600
+G1 X103.486 Y60.152 E13.8000 F3600
+G1 X104.181 Y60.219 E13.8500 F3600
+G1 X104.875 Y60.298 E13.9000 F3600
+G1 X105.567 Y60.389 E13.9500 F3600
+G1 X106.257 Y60.492 E14.0000 F3600
+G1 X106.946 Y60.608 E14.0500 F3600
+G1 X107.632 Y60.735 E14.1000 F3600
+G1 X108.316 Y60.874 E14.1500 F3600
+G1 X108.998 Y61.025 E14.2000 F3600
+G1 X109.677 Y61.188 E14.2500 F3600
+G1 X110.353 Y61.363 E14.3000 F3600
+G1 X111.025 Y61.550 E14.3500 F3600
+G1 X111.695 Y61.748 E14.4000 F3600
+G1 X112.361 Y61.958 E14.4500 F3600
+G1 X113.023 Y62.179 E14.5000 F3600
+G1 X113.681 Y62.412 E14.5500 F3600
+G1 X114.335 Y62.657 E14.6000 F3600
+G1 X114.984 Y62.913 E14.6500 F3600
+G1 X115.629 Y63.180 E14.7000 F3600
+G1 X116.269 Y63.458 E14.7500 F3600
+G1 X116.905 Y63.748 E14.8000 F3600
+G1 X117.535 Y64.048 E14.8500 F3600
+G1 X118.160 Y64.360 E14.9000 F3600
+G1 X118.779 Y64.682 E14.9500 F3600
+G1 X119.392 Y65.015 E15.0000 F3600
+G1 X120.000 Y65.359 E15.0500 F3600
+G1 X120.602 Y65.713 E15.1000 F3600
+G1 X121.197 Y66.078 E15.1500 F3600
+G1 X121.786 Y66.453 E15.2000 F3600
+G1 X122.368 Y66.838 E15.2500 F3600
+G1 X122.943 Y67.234 E15.3000 F3600
+G1 X123.511 Y67.639 E15.3500 F3600
+G1 X124.073 Y68.055 E15.4000 F3600
+G1 X124.626 Y68.480 E15.4500 F3600
+G1 X125.173 Y68.914 E15.5000 F3600
+G1 X125.712 Y69.358 E15.5500 F3600
+G1 X126.242 Y69.812 E15.6000 F3600
+G1 X126.765 Y70.274 E15.6500 F3600
+G1 X127.280 Y70.746 E15.7000 F3600
+G1 X127.786 Y71.226 E15.7500 F3600
+G1 X128.284 Y71.716 E15.8000 F3600
+G1 X128.774 Y72.214 E15.8500 F3600
+G1 X129.254 Y72.720 E15.9000 F3600
+G1 X129.726 Y73.235 E15.9500 F3600
+G1 X130.188 Y73.758 E16.0000 F3600
+G1 X130.642 Y74.288 E16.0500 F3600
+G1 X131.086 Y74.827 E16.1000 F3600
+G1 X131.520 Y75.374 E16.1500 F3600
+G1 X131.945 Y75.927 E16.2000 F3600
+G1 X132.361 Y76.489 E16.2500 F3600
+G1 X132.766 Y77.057 E16.3000 F3600
+G1 X133.162 Y77.632 E16.3500 F3600
+G1 X133.547 Y78.214 E16.4000 F3600
+G1 X133.922 Y78.803 E16.4500 F3600
+G1 X134.287 Y79.398 E16.5000 F3600
+G1 X134.641 Y80.000 E16.5500 F3600
+G1 X134.985 Y80.608 E16.6000 F3600
+G1 X135.318 Y81.221 E16.6500 F3600
+G1 X135.640 Y81.840 E16.7000 F3600
+G1 X135.952 Y82.465 E16.7500 F3600
+G1 X136.252 Y83.095 E16.8000 F3600
+G1 X136.542 Y83.731 E16.8500 F3600
+G1 X136.820 Y84.371 E16.9000 F3600
+G1 X137.087 Y85.016 E16.9500 F3600
+G1 X137.343 Y85.665 E17.0000 F3600
+G1 X137.588 Y86.319 E17.0500 F3600
+G1 X137.821 Y86.977 E17.1000 F3600
+G1 X138.042 Y87.639 E17.1500 F3600
+G1 X138.252 Y88.305 E17.2000 F3600
+G1 X138.450 Y88.975 E17.2500 F3600
+G1 X138.637 Y89.647 E17.3000 F3600
+G1 X138.812 Y90.323 E17.3500 F3600
+G1 X138.975 Y91.002 E17.4000 F3600
+G1 X139.126 Y91.684 E17.4500 F3600
+G1 X139.265 Y92.368 E17.5000 F3600
+G1 X139.392 Y93.054 E17.5500 F3600
+G1 X139.508 Y93.743 E17.6000 F3600
+G1 X139.611 Y94.433 E17.6500 F3600
+G1 X139.702 Y95.125 E17.7000 F3600
+G1 X139.781 Y95.819 E17.7500 F3600
+G1 X139.848 Y96.514 E17.8000 F3600
+G1 X139.903 Y97.210 E17.8500 F3600
+G1 X139.945 Y97.907 E17.9000 F3600
+G1 X139.976 Y98.604 E17.9500 F3600
+G1 X139.994 Y99.302 E18.0000 F3600
+G1 X140.000 Y100.000 E18.0500 F3600
+G1 X10 Y10 F9000 ; travel
+G1 X10 Y10 E18.050 F2400
+G1 X60 Y10 E18.150 F2400
+G1 X10 Y10 E18.250 F2400
+G1 X60 Y10 E18.350 F2400
+G1 X10 Y10 E18.450 F2400
+G1 X60 Y10 E18.550 F2400
+G1 X10 Y10 E18.650 F2400
+G1 X60 Y10 E18.750 F2400
+G1 X10 Y10 E18.850 F2400
+G1 X60 Y10 E18.950 F2400
+G1 X140.000 Y100.000 E18.1000 F3600
+G1 X139.994 Y100.698 E18.1500 F3600
+G1 X139.976 Y101.396 E18.2000 F3600
+G1 X139.945 Y102.093 E18.2500 F3600
+G1 X139.903 Y102.790 E18.3000 F3600
+G1 X139.848 Y103.486 E18.3500 F3600
+G1 X139.781 Y104.181 E18.4000 F3600
+G1 X139.702 Y104.875 E18.4500 F3600
+G1 X139.611 Y105.567 E18.5000 F3600
+G1 X139.508 Y106.257 E18.5500 F3600
+G1 X139.392 Y106.946 E18.6000 F3600
+G1 X139.265 Y107.632 E18.6500 F3600
+G1 X139.126 Y108.316 E18.7000 F3600
+G1 X138.975 Y108.998 E18.7500 F3600
+G1 X138.812 Y109.677 E18.8000 F3600
+G1 X138.637 Y110.353 E18.8500 F3600
+G1 X138.450 Y111.025 E18.9000 F3600
+G1 X138.252 Y111.695 E18.9500 F3600
+G1 X138.042 Y112.361 E19.0000 F3600
+G1 X137.821 Y113.023 E19.0500 F3600
+G1 X137.588 Y113.681 E19.1000 F3600
+G1 X137.343 Y114.335 E19.1500 F3600
+G1 X137.087 Y114.984 E19.2000 F3600
+G1 X136.820 Y115.629 E19.2500 F3600
+G1 X136.542 Y116.269 E19.3000 F3600
+G1 X136.252 Y116.905 E19.3500 F3600
+G1 X135.952 Y117.535 E19.4000 F3600
+G1 X135.640 Y118.160 E19.4500 F3600
+G1 X135.318 Y118.779 E19.5000 F3600
+G1 X134.985 Y119.392 E19.5500 F3600
+G1 X134.641 Y120.000 E19.6000 F3600
+G1 X134.287 Y120.602 E19.6500 F3600
+G1 X133.922 Y121.197 E19.7000 F3600
+G1 X133.547 Y121.786 E19.7500 F3600
+G1 X133.162 Y122.368 E19.8000 F3600
+G1 X132.766 Y122.943 E19.8500 F3600
+G1 X132.361 Y123.511 E19.9000 F3600
+G1 X131.945 Y124.073 E19.9500 F3600
+G1 X131.520 Y124.626 E20.0000 F3600
+G1 X131.086 Y125.173 E20.0500 F3600
+G1 X130.642 Y125.712 E20.1000 F3600
+G1 X130.188 Y126.242 E20.1500 F3600
+G1 X129.726 Y126.765 E20.2000 F3600
+G1 X129.254 Y127.280 E20.2500 F3600
+G1 X128.774 Y127.786 E20.3000 F3600
+G1 X128.284 Y128.284 E20.3500 F3600
+G1 X127.786 Y128.774 E20.4000 F3600
+G1 X127.280 Y129.254 E20.4500 F3600
+G1 X126.765 Y129.726 E20.5000 F3600
+G1 X126.242 Y130.188 E20.5500 F3600
+G1 X125.712 Y130.642 E20.6000 F3600
+G1 X125.173 Y131.086 E20.6500 F3600
+G1 X124.626 Y131.520 E20.7000 F3600
+G1 X124.073 Y131.945 E20.7500 F3600
+G1 X123.511 Y132.361 E20.8000 F3600
+G1 X122.943 Y132.766 E20.8500 F3600
+G1 X122.368 Y133.162 E20.9000 F3600
+G1 X121.786 Y133.547 E20.9500 F3600
+G1 X121.197 Y133.922 E21.0000 F3600
+G1 X120.602 Y134.287 E21.0500 F3600
+G1 X120.000 Y134.641 E21.1000 F3600
+G1 X119.392 Y134.985 E21.1500 F3600
+G1 X118.779 Y135.318 E21.2000 F3600
+G1 X118.160 Y135.640 E21.2500 F3600
+G1 X117.535 Y135.952 E21.3000 F3600
+G1 X116.905 Y136.252 E21.3500 F3600
+G1 X116.269 Y136.542 E21.4000 F3600
+G1 X115.629 Y136.820 E21.4500 F3600
+G1 X114.984 Y137.087 E21.5000 F3600
+G1 X114.335 Y137.343 E21.5500 F3600
+G1 X113.681 Y137.588 E21.6000 F3600
+G1 X113.023 Y137.821 E21.6500 F3600
+G1 X112.361 Y138.042 E21.7000 F3600
+G1 X111.695 Y138.252 E21.7500 F3600
+G1 X111.025 Y138.450 E21.8000 F3600
+G1 X110.353 Y138.637 E21.8500 F3600
+G1 X109.677 Y138.812 E21.9000 F3600
+G1 X108.998 Y138.975 E21.9500 F3600
+G1 X108.316 Y139.126 E22.0000 F3600
+G1 X107.632 Y139.265 E22.0500 F3600
+G1 X106.946 Y139.392 E22.1000 F3600
+G1 X106.257 Y139.508 E22.1500 F3600
+G1 X105.567 Y139.611 E22.2000 F3600
+G1 X104.875 Y139.702 E22.2500 F3600
+G1 X104.181 Y139.781 E22.3000 F3600
+G1 X103.486 Y139.848 E22.3500 F3600
+G1 X102.790 Y139.903 E22.4000 F3600
+G1 X102.093 Y139.945 E22.4500 F3600
+G1 X101.396 Y139.976 E22.5000 F3600
+G1 X100.698 Y139.994 E22.5500 F3600
+G1 X100.000 Y140.000 E22.6000 F3600
+G1 X99.302 Y139.994 E22.6500 F3600
+G1 X98.604 Y139.976 E22.7000 F3600
+G1 X97.907 Y139.945 E22.7500 F3600
+G1 X97.210 Y139.903 E22.8000 F3600
+G1 X96.514 Y139.848 E22.8500 F3600
+G1 X95.819 Y139.781 E22.9000 F3600
+G1 X95.125 Y139.702 E22.9500 F3600
+G1 X94.433 Y139.611 E23.0000 F3600
+G1 X93.743 Y139.508 E23.0500 F3600
+G1 X93.054 Y139.392 E23.1000 F3600
+G1 X92.368 Y139.265 E23.1500 F3600
+G1 X91.684 Y139.126 E23.2000 F3600
+G1 X91.002 Y138.975 E23.2500 F3600
+G1 X90.323 Y138.812 E23.3000 F3600
+G1 X89.647 Y138.637 E23.3500 F3600
+G1 X88.975 Y138.450 E23.4000 F3600
+G1 X88.305 Y138.252 E23.4500 F3600
+G1 X87.639 Y138.042 E23.5000 F3600
+G1 X86.977 Y137.821 E23.5500 F3600
+G1 X86.319 Y137.588 E23.6000 F3600
+G1 X85.665 Y137.343 E23.6500 F3600
+G1 X85.016 Y137.087 E23.7000 F3600
+G1 X84.371 Y136.820 E23.7500 F3600
+G1 X83.731 Y136.542 E23.8000 F3600
+G1 X83.095 Y136.252 E23.8500 F3600
+G1 X82.465 Y135.952 E23.9000 F3600
+G1 X81.840 Y135.640 E23.9500 F3600
+G1 X81.221 Y135.318 E24.0000 F3600
+G1 X80.608 Y134.985 E24.0500 F3600
+G1 X80.000 Y134.641 E24.1000 F3600
+G1 X79.398 Y134.287 E24.1500 F3600
+G1 X78.803 Y133.922 E24.2000 F3600
+G1 X78.214 Y133.547 E24.2500 F3600
+G1 X77.632 Y133.162 E24.3000 F3600
+G1 X77.057 Y132.766 E24.3500 F3600
+G1 X76.489 Y132.361 E24.4000 F3600
+G1 X75.927 Y131.945 E24.4500 F3600
+G1 X75.374 Y131.520 E24.5000 F3600
+G1 X74.827 Y131.086 E24.5500 F3600
+G1 X74.288 Y130.642 E24.6000 F3600
+G1 X73.758 Y130.188 E24.6500 F3600
+G1 X73.235 Y129.726 E24.7000 F3600
+G1 X72.720 Y129.254 E24.7500 F3600
+G1 X72.214 Y128.774 E24.8000 F3600
+G1 X71.716 Y128.284 E24.8500 F3600
+G1 X71.226 Y127.786 E24.9000 F3600
+G1 X70.746 Y127.280 E24.9500 F3600
+G1 X70.274 Y126.765 E25.0000 F3600
+G1 X69.812 Y126.242 E25.0500 F3600
+G1 X69.358 Y125.712 E25.1000 F3600
+G1 X68.914 Y125.173 E25.1500 F3600
+G1 X68.480 Y124.626 E25.2000 F3600
+G1 X68.055 Y124.073 E25.2500 F3600
+G1 X67.639 Y123.511 E25.3000 F3600
+G1 X67.234 Y122.943 E25.3500 F3600
+G1 X66.838 Y122.368 E25.4000 F3600
+G1 X66.453 Y121.786 E25.4500 F3600
+G1 X66.078 Y121.197 E25.5000 F3600
+G1 X65.713 Y120.602 E25.5500 F3600
+G1 X65.359 Y120.000 E25.6000 F3600
+G1 X65.015 Y119.392 E25.6500 F3600
+G1 X64.682 Y118.779 E25.7000 F3600
+G1 X64.360 Y118.160 E25.7500 F3600
+G1 X64.048 Y117.535 E25.8000 F3600
+G1 X63.748 Y116.905 E25.8500 F3600
+G1 X63.458 Y116.269 E25.9000 F3600
+G1 X63.180 Y115.629 E25.9500 F3600
+G1 X62.913 Y114.984 E26.0000 F3600
+G1 X62.657 Y114.335 E26.0500 F3600
+G1 X62.412 Y113.681 E26.1000 F3600
+G1 X62.179 Y113.023 E26.1500 F3600
+G1 X61.958 Y112.361 E26.2000 F3600
+G1 X61.748 Y111.695 E26.2500 F3600
+G1 X61.550 Y111.025 E26.3000 F3600
+G1 X61.363 Y110.353 E26.3500 F3600
+G1 X61.188 Y109.677 E26.4000 F3600
+G1 X61.025 Y108.998 E26.4500 F3600
+G1 X60.874 Y108.316 E26.5000 F3600
+G1 X60.735 Y107.632 E26.5500 F3600
+G1 X60.608 Y106.946 E26.6000 F3600
+G1 X60.492 Y106.257 E26.6500 F3600
+G1 X60.389 Y105.567 E26.7000 F3600
+G1 X60.298 Y104.875 E26.7500 F3600
+G1 X60.219 Y104.181 E26.8000 F3600
+G1 X60.152 Y103.486 E26.8500 F3600
+G1 X60.097 Y102.790 E26.9000 F3600
+G1 X60.055 Y102.093 E26.9500 F3600
+G1 X60.024 Y101.396 E27.0000 F3600
+G1 X60.006 Y100.698 E27.0500 F3600
+G1 X60.000 Y100.000 E27.1000 F3600
+G1 X60.006 Y99.302 E27.1500 F3600
+G1 X60.024 Y98.604 E27.2000 F3600
+G1 X60.055 Y97.907 E27.2500 F3600
+G1 X60.097 Y97.210 E27.3000 F3600
+G1 X60.152 Y96.514 E27.3500 F3600
+G1 X60.219 Y95.819 E27.4000 F3600
+G1 X60.298 Y95.125 E27.4500 F3600
+G1 X60.389 Y94.433 E27.5000 F3600
+G1 X60.492 Y93.743 E27.5500 F3600
+G1 X60.608 Y93.054 E27.6000 F3600
+G1 X60.735 Y92.368 E27.6500 F3600
+G1 X60.874 Y91.684 E27.7000 F3600
+G1 X61.025 Y91.002 E27.7500 F3600
+G1 X61.188 Y90.323 E27.8000 F3600
+G1 X61.363 Y89.647 E27.8500 F3600
+G1 X61.550 Y88.975 E27.9000 F3600
+G1 X61.748 Y88.305 E27.9500 F3600
+G1 X61.958 Y87.639 E28.0000 F3600
+G1 X62.179 Y86.977 E28.0500 F3600
+G1 X62.412 Y86.319 E28.1000 F3600
+G1 X62.657 Y85.665 E28.1500 F3600
+G1 X62.913 Y85.016 E28.2000 F3600
+G1 X63.180 Y84.371 E28.2500 F3600
+G1 X63.458 Y83.731 E28.3000 F3600
+G1 X63.748 Y83.095 E28.3500 F3600
+G1 X64.048 Y82.465 E28.4000 F3600
+G1 X64.360 Y81.840 E28.4500 F3600
+G1 X64.682 Y81.221 E28.5000 F3600
+G1 X65.015 Y80.608 E28.5500 F3600
+G1 X65.359 Y80.000 E28.6000 F3600
+G1 X65.713 Y79.398 E28.6500 F3600
+G1 X66.078 Y78.803 E28.7000 F3600
+G1 X66.453 Y78.214 E28.7500 F3600
+G1 X66.838 Y77.632 E28.8000 F3600
+G1 X67.234 Y77.057 E28.8500 F3600
+G1 X67.639 Y76.489 E28.9000 F3600
+G1 X68.055 Y75.927 E28.9500 F3600
+G1 X68.480 Y75.374 E29.0000 F3600
+G1 X68.914 Y74.827 E29.0500 F3600
+G1 X69.358 Y74.288 E29.1000 F3600
+G1 X69.812 Y73.758 E29.1500 F3600
+G1 X70.274 Y73.235 E29.2000 F3600
+G1 X70.746 Y72.720 E29.2500 F3600
+G1 X71.226 Y72.214 E29.3000 F3600
+G1 X71.716 Y71.716 E29.3500 F3600
+G1 X72.214 Y71.226 E29.4000 F3600
+G1 X72.720 Y70.746 E29.4500 F3600
+G1 X73.235 Y70.274 E29.5000 F3600
+G1 X73.758 Y69.812 E29.5500 F3600
+G1 X74.288 Y69.358 E29.6000 F3600
+G1 X74.827 Y68.914 E29.6500 F3600
+G1 X75.374 Y68.480 E29.7000 F3600
+G1 X75.927 Y68.055 E29.7500 F3600
+G1 X76.489 Y67.639 E29.8000 F3600
+G1 X77.057 Y67.234 E29.8500 F3600
+G1 X77.632 Y66.838 E29.9000 F3600
+G1 X78.214 Y66.453 E29.9500 F3600
+G1 X78.803 Y66.078 E30.0000 F3600
+G1 X79.398 Y65.713 E30.0500 F3600
+G1 X80.000 Y65.359 E30.1000 F3600
+G1 X80.608 Y65.015 E30.1500 F3600
+G1 X81.221 Y64.682 E30.2000 F3600
+G1 X81.840 Y64.360 E30.2500 F3600
+G1 X82.465 Y64.048 E30.3000 F3600
+G1 X83.095 Y63.748 E30.3500 F3600
+G1 X83.731 Y63.458 E30.4000 F3600
+G1 X84.371 Y63.180 E30.4500 F3600
+G1 X85.016 Y62.913 E30.5000 F3600
+G1 X85.665 Y62.657 E30.5500 F3600
+G1 X86.319 Y62.412 E30.6000 F3600
+G1 X86.977 Y62.179 E30.6500 F3600
+G1 X87.639 Y61.958 E30.7000 F3600
+G1 X88.305 Y61.748 E30.7500 F3600
+G1 X88.975 Y61.550 E30.8000 F3600
+G1 X89.647 Y61.363 E30.8500 F3600
+G1 X90.323 Y61.188 E30.9000 F3600
+G1 X91.002 Y61.025 E30.9500 F3600
+G1 X91.684 Y60.874 E31.0000 F3600
+G1 X92.368 Y60.735 E31.0500 F3600
+G1 X93.054 Y60.608 E31.1000 F3600
+G1 X93.743 Y60.492 E31.1500 F3600
+G1 X94.433 Y60.389 E31.2000 F3600
+G1 X95.125 Y60.298 E31.2500 F3600
+G1 X95.819 Y60.219 E31.3000 F3600
+G1 X96.514 Y60.152 E31.3500 F3600
+G1 X97.210 Y60.097 E31.4000 F3600
+G1 X97.907 Y60.055 E31.4500 F3600
+G1 X98.604 Y60.024 E31.5000 F3600
+G1 X99.302 Y60.006 E31.5500 F3600
+G1 X100.000 Y60.000 E31.6000 F3600
+G1 X100.698 Y60.006 E31.6500 F3600
+G1 X101.396 Y60.024 E31.7000 F3600
+G1 X102.093 Y60.055 E31.7500 F3600
+G1 X102.790 Y60.097 E31.8000 F3600
+G1 X103.486 Y60.152 E31.8500 F3600
+G1 X104.181 Y60.219 E31.9000 F3600
+G1 X104.875 Y60.298 E31.9500 F3600
+G1 X105.567 Y60.389 E32.0000 F3600
+G1 X106.257 Y60.492 E32.0500 F3600
+G1 X106.946 Y60.608 E32.1000 F3600
+G1 X107.632 Y60.735 E32.1500 F3600
+G1 X108.316 Y60.874 E32.2000 F3600
+G1 X108.998 Y61.025 E32.2500 F3600
+G1 X109.677 Y61.188 E32.3000 F3600
+G1 X110.353 Y61.363 E32.3500 F3600
+G1 X111.025 Y61.550 E32.4000 F3600
+G1 X111.695 Y61.748 E32.4500 F3600
+G1 X112.361 Y61.958 E32.5000 F3600
+G1 X113.023 Y62.179 E32.5500 F3600
+G1 X113.681 Y62.412 E32.6000 F3600
+G1 X114.335 Y62.657 E32.6500 F3600
+G1 X114.984 Y62.913 E32.7000 F3600
+G1 X115.629 Y63.180 E32.7500 F3600
+G1 X116.269 Y63.458 E32.8000 F3600
+G1 X116.905 Y63.748 E32.8500 F3600
+G1 X117.535 Y64.048 E32.9000 F3600
+G1 X118.160 Y64.360 E32.9500 F3600
+G1 X118.779 Y64.682 E33.0000 F3600
+G1 X119.392 Y65.015 E33.0500 F3600
+G1 X120.000 Y65.359 E33.1000 F3600
+G1 X120.602 Y65.713 E33.1500 F3600
+G1 X121.197 Y66.078 E33.2000 F3600
+G1 X121.786 Y66.453 E33.2500 F3600
+G1 X122.368 Y66.838 E33.3000 F3600
+G1 X122.943 Y67.234 E33.3500 F3600
+G1 X123.511 Y67.639 E33.4000 F3600
+G1 X124.073 Y68.055 E33.4500 F3600
+G1 X124.626 Y68.480 E33.5000 F3600
+G1 X125.173 Y68.914 E33.5500 F3600
+G1 X125.712 Y69.358 E33.6000 F3600
+G1 X126.242 Y69.812 E33.6500 F3600
+G1 X126.765 Y70.274 E33.7000 F3600
+G1 X127.280 Y70.746 E33.7500 F3600
+G1 X127.786 Y71.226 E33.8000 F3600
+G1 X128.284 Y71.716 E33.8500 F3600
+G1 X128.774 Y72.214 E33.9000 F3600
+G1 X129.254 Y72.720 E33.9500 F3600
+G1 X129.726 Y73.235 E34.0000 F3600
+G1 X130.188 Y73.758 E34.0500 F3600
+G1 X130.642 Y74.288 E34.1000 F3600
+G1 X131.086 Y74.827 E34.1500 F3600
+G1 X131.520 Y75.374 E34.2000 F3600
+G1 X131.945 Y75.927 E34.2500 F3600
+G1 X132.361 Y76.489 E34.3000 F3600
+G1 X132.766 Y77.057 E34.3500 F3600
+G1 X133.162 Y77.632 E34.4000 F3600
+G1 X133.547 Y78.214 E34.4500 F3600
+G1 X133.922 Y78.803 E34.5000 F3600
+G1 X134.287 Y79.398 E34.5500 F3600
+G1 X134.641 Y80.000 E34.6000 F3600
+G1 X134.985 Y80.608 E34.6500 F3600
+G1 X135.318 Y81.221 E34.7000 F3600
+G1 X135.640 Y81.840 E34.7500 F3600
+G1 X135.952 Y82.465 E34.8000 F3600
+G1 X136.252 Y83.095 E34.8500 F3600
+G1 X136.542 Y83.731 E34.9000 F3600
+G1 X136.820 Y84.371 E34.9500 F3600
+G1 X137.087 Y85.016 E35.0000 F3600
+G1 X137.343 Y85.665 E35.0500 F3600
+G1 X137.588 Y86.319 E35.1000 F3600
+G1 X137.821 Y86.977 E35.1500 F3600
+G1 X138.042 Y87.639 E35.2000 F3600
+G1 X138.252 Y88.305 E35.2500 F3600
+G1 X138.450 Y88.975 E35.3000 F3600
+G1 X138.637 Y89.647 E35.3500 F3600
+G1 X138.812 Y90.323 E35.4000 F3600
+G1 X138.975 Y91.002 E35.4500 F3600
+G1 X139.126 Y91.684 E35.5000 F3600
+G1 X139.265 Y92.368 E35.5500 F3600
+G1 X139.392 Y93.054 E35.6000 F3600
+G1 X139.508 Y93.743 E35.6500 F3600
+G1 X139.611 Y94.433 E35.7000 F3600
+G1 X139.702 Y95.125 E35.7500 F3600
+G1 X139.781 Y95.819 E35.8000 F3600
+G1 X139.848 Y96.514 E35.8500 F3600
+G1 X139.903 Y97.210 E35.9000 F3600
+G1 X139.945 Y97.907 E35.9500 F3600
+G1 X139.976 Y98.604 E36.0000 F3600
+G1 X139.994 Y99.302 E36.0500 F3600
+G1 X140.000 Y100.000 E36.1000 F3600
+G1 X10 Y10 F9000 ; travel
+G1 X10 Y10 E36.100 F2400
+G1 X60 Y10 E36.200 F2400
+G1 X10 Y10 E36.300 F2400
+G1 X60 Y10 E36.400 F2400
+G1 X10 Y10 E36.500 F2400
+G1 X60 Y10 E36.600 F2400
+G1 X10 Y10 E36.700 F2400
+G1 X60 Y10 E36.800 F2400
+G1 X10 Y10 E36.900 F2400
+G1 X60 Y10 E37.000 F2400
+G1 X140.000 Y100.000 E36.1500 F3600
+G1 X139.994 Y100.698 E36.2000 F3600
+G1 X139.976 Y101.396 E36.2500 F3600
+G1 X139.945 Y102.093 E36.3000 F3600
+G1 X139.903 Y102.790 E36.3500 F3600
+G1 X139.848 Y103.486 E36.4000 F3600
+G1 X139.781 Y104.181 E36.4500 F3600
+G1 X139.702 Y104.875 E36.5000 F3600
+G1 X139.611 Y105.567 E36.5500 F3600
+G1 X139.508 Y106.257 E36.6000 F3600
+G1 X139.392 Y106.946 E36.6500 F3600
+G1 X139.265 Y107.632 E36.7000 F3600
+G1 X139.126 Y108.316 E36.7500 F3600
+G1 X138.975 Y108.998 E36.8000 F3600
+G1 X138.812 Y109.677 E36.8500 F3600
+G1 X138.637 Y110.353 E36.9000 F3600
+G1 X138.450 Y111.025 E36.9500 F3600
+G1 X138.252 Y111.695 E37.0000 F3600
+G1 X138.042 Y112.361 E37.0500 F3600
+G1 X137.821 Y113.023 E37.1000 F3600
+G1 X137.588 Y113.681 E37.1500 F3600
+G1 X137.343 Y114.335 E37.2000 F3600
+G1 X137.087 Y114.984 E37.2500 F3600
+G1 X136.820 Y115.629 E37.3000 F3600
+G1 X136.542 Y116.269 E37.3500 F3600
+G1 X136.252 Y116.905 E37.4000 F3600
+G1 X135.952 Y117.535 E37.4500 F3600
+G1 X135.640 Y118.160 E37.5000 F3600
+G1 X135.318 Y118.779 E37.5500 F3600
+G1 X134.985 Y119.392 E37.6000 F3600
+G1 X134.641 Y120.000 E37.6500 F3600
+G1 X134.287 Y120.602 E37.7000 F3600
+G1 X133.922 Y121.197 E37.7500 F3600
+G1 X133.547 Y121.786 E37.8000 F3600
+G1 X133.162 Y122.368 E37.8500 F3600
+G1 X132.766 Y122.943 E37.9000 F3600
+G1 X132.361 Y123.511 E37.9500 F3600
+G1 X131.945 Y124.073 E38.0000 F3600
+G1 X131.520 Y124.626 E38.0500 F3600
+G1 X131.086 Y125.173 E38.1000 F3600
+G1 X130.642 Y125.712 E38.1500 F3600
+G1 X130.188 Y126.242 E38.2000 F3600
+G1 X129.726 Y126.765 E38.2500 F3600
+G1 X129.254 Y127.280 E38.3000 F3600
+G1 X128.774 Y127.786 E38.3500 F3600
+G1 X128.284 Y128.284 E38.4000 F3600
+G1 X127.786 Y128.774 E38.4500 F3600
+G1 X127.280 Y129.254 E38.5000 F3600
+G1 X126.765 Y129.726 E38.5500 F3600
+G1 X126.242 Y130.188 E38.6000 F3600
+G1 X125.712 Y130.642 E38.6500 F3600
+G1 X125.173 Y131.086 E38.7000 F3600
+G1 X124.626 Y131.520 E38.7500 F3600
+G1 X124.073 Y131.945 E38.8000 F3600
+G1 X123.511 Y132.361 E38.8500 F3600
+G1 X122.943 Y132.766 E38.9000 F3600
+G1 X122.368 Y133.162 E38.9500 F3600
+G1 X121.786 Y133.547 E39.0000 F3600
+G1 X121.197 Y133.922 E39.0500 F3600
+G1 X120.602 Y134.287 E39.1000 F3600
+G1 X120.000 Y134.641 E39.1500 F3600
+G1 X119.392 Y134.985 E39.2000 F3600
+G1 X118.779 Y135.318 E39.2500 F3600
+G1 X118.160 Y135.640 E39.3000 F3600
+G1 X117.535 Y135.952 E39.3500 F3600
+G1 X116.905 Y136.252 E39.4000 F3600
+G1 X116.269 Y136.542 E39.4500 F3600
+G1 X115.629 Y136.820 E39.5000 F3600
+G1 X114.984 Y137.087 E39.5500 F3600
+G1 X114.335 Y137.343 E39.6000 F3600
+G1 X113.681 Y137.588 E39.6500 F3600
+G1 X113.023 Y137.821 E39.7000 F3600
+G1 X112.361 Y138.042 E39.7500 F3600
+G1 X111.695 Y138.252 E39.8000 F3600
+G1 X111.025 Y138.450 E39.8500 F3600
+G1 X110.353 Y138.637 E39.9000 F3600
+G1 X109.677 Y138.812 E39.9500 F3600
+G1 X108.998 Y138.975 E40.0000 F3600
+G1 X108.316 Y139.126 E40.0500 F3600
+G1 X107.632 Y139.265 E40.1000 F3600
+G1 X106.946 Y139.392 E40.1500 F3600
+G1 X106.257 Y139.508 E40.2000 F3600
+G1 X105.567 Y139.611 E40.2500 F3600
+G1 X104.875 Y139.702 E40.3000 F3600
+G1 X104.181 Y139.781 E40.3500 F3600
+G1 X103.486 Y139.848 E40.4000 F3600
+G1 X102.790 Y139.903 E40.4500 F3600
+G1 X102.093 Y139.945 E40.5000 F3600
+G1 X101.396 Y139.976 E40.5500 F3600
+G1 X100.698 Y139.994 E40.6000 F3600
+G1 X100.000 Y140.000 E40.6500 F3600
+G1 X99.302 Y139.994 E40.7000 F3600
+G1 X98.604 Y139.976 E40.7500 F3600
+G1 X97.907 Y139.945 E40.8000 F3600
+G1 X97.210 Y139.903 E40.8500 F3600
+G1 X96.514 Y139.848 E40.9000 F3600
+G1 X95.819 Y139.781 E40.9500 F3600
+G1 X95.125 Y139.702 E41.0000 F3600
+G1 X94.433 Y139.611 E41.0500 F3600
+G1 X93.743 Y139.508 E41.1000 F3600
+G1 X93.054 Y139.392 E41.1500 F3600
+G1 X92.368 Y139.265 E41.2000 F3600
+G1 X91.684 Y139.126 E41.2500 F3600
+G1 X91.002 Y138.975 E41.3000 F3600
+G1 X90.323 Y138.812 E41.3500 F3600
+G1 X89.647 Y138.637 E41.4000 F3600
+G1 X88.975 Y138.450 E41.4500 F3600
+G1 X88.305 Y138.252 E41.5000 F3600
+G1 X87.639 Y138.042 E41.5500 F3600
+G1 X86.977 Y137.821 E41.6000 F3600
+G1 X86.319 Y137.588 E41.6500 F3600
+G1 X85.665 Y137.343 E41.7000 F3600
+G1 X85.016 Y137.087 E41.7500 F3600
+G1 X84.371 Y136.820 E41.8000 F3600
+G1 X83.731 Y136.542 E41.8500 F3600
+G1 X83.095 Y136.252 E41.9000 F3600
+G1 X82.465 Y135.952 E41.9500 F3600
+G1 X81.840 Y135.640 E42.0000 F3600
+G1 X81.221 Y135.318 E42.0500 F3600
+G1 X80.608 Y134.985 E42.1000 F3600
+G1 X80.000 Y134.641 E42.1500 F3600
+G1 X79.398 Y134.287 E42.2000 F3600
+G1 X78.803 Y133.922 E42.2500 F3600
+G1 X78.214 Y133.547 E42.3000 F3600
+G1 X77.632 Y133.162 E42.3500 F3600
+G1 X77.057 Y132.766 E42.4000 F3600
+G1 X76.489 Y132.361 E42.4500 F3600
+G1 X75.927 Y131.945 E42.5000 F3600
+G1 X75.374 Y131.520 E42.5500 F3600
+G1 X74.827 Y131.086 E42.6000 F3600
+G1 X74.288 Y130.642 E42.6500 F3600
+G1 X73.758 Y130.188 E42.7000 F3600
+G1 X73.235 Y129.726 E42.7500 F3600
+G1 X72.720 Y129.254 E42.8000 F3600
+G1 X72.214 Y128.774 E42.8500 F3600
+G1 X71.716 Y128.284 E42.9000 F3600
+G1 X71.226 Y127.786 E42.9500 F3600
+G1 X70.746 Y127.280 E43.0000 F3600
+G1 X70.274 Y126.765 E43.0500 F3600
+G1 X69.812 Y126.242 E43.1000 F3600
+G1 X69.358 Y125.712 E43.1500 F3600
+G1 X68.914 Y125.173 E43.2000 F3600
+G1 X68.480 Y124.626 E43.2500 F3600
+G1 X68.055 Y124.073 E43.3000 F3600
+G1 X67.639 Y123.511 E43.3500 F3600
+G1 X67.234 Y122.943 E43.4000 F3600
+G1 X66.838 Y122.368 E43.4500 F3600
+G1 X66.453 Y121.786 E43.5000 F3600
+G1 X66.078 Y121.197 E43.5500 F3600
+G1 X65.713 Y120.602 E43.6000 F3600
+G1 X65.359 Y120.000 E43.6500 F3600
+G1 X65.015 Y119.392 E43.7000 F3600
+G1 X64.682 Y118.779 E43.7500 F3600
+G1 X64.360 Y118.160 E43.8000 F3600
+G1 X64.048 Y117.535 E43.8500 F3600
+G1 X63.748 Y116.905 E43.9000 F3600
+G1 X63.458 Y116.269 E43.9500 F3600
+G1 X63.180 Y115.629 E44.0000 F3600
+G1 X62.913 Y114.984 E44.0500 F3600
+G1 X62.657 Y114.335 E44.1000 F3600
+G1 X62.412 Y113.681 E44.1500 F3600
+G1 X62.179 Y113.023 E44.2000 F3600
+G1 X61.958 Y112.361 E44.2500 F3600
+G1 X61.748 Y111.695 E44.3000 F3600
+G1 X61.550 Y111.025 E44.3500 F3600
+G1 X61.363 Y110.353 E44.4000 F3600
+G1 X61.188 Y109.677 E44.4500 F3600
+G1 X61.025 Y108.998 E44.5000 F3600
+G1 X60.874 Y108.316 E44.5500 F3600
+G1 X60.735 Y107.632 E44.6000 F3600
+G1 X60.608 Y106.946 E44.6500 F3600
+G1 X60.492 Y106.257 E44.7000 F3600
+G1 X60.389 Y105.567 E44.7500 F3600
+G1 X60.298 Y104.875 E44.8000 F3600
+G1 X60.219 Y104.181 E44.8500 F3600
+G1 X60.152 Y103.486 E44.9000 F3600
+G1 X60.097 Y102.790 E44.9500 F3600
+G1 X60.055 Y102.093 E45.0000 F3600
+G1 X60.024 Y101.396 E45.0500 F3600
+G1 X60.006 Y100.698 E45.1000 F3600
+G1 X60.000 Y100.000 E45.1500 F3600
+G1 X60.006 Y99.302 E45.2000 F3600
+G1 X60.024 Y98.604 E45.2500 F3600
+G1 X60.055 Y97.907 E45.3000 F3600
+G1 X60.097 Y97.210 E45.3500 F3600
+G1 X60.152 Y96.514 E45.4000 F3600
+G1 X60.219 Y95.819 E45.4500 F3600
+G1 X60.298 Y95.125 E45.5000 F3600
+G1 X60.389 Y94.433 E45.5500 F3600
+G1 X60.492 Y93.743 E45.6000 F3600
+G1 X60.608 Y93.054 E45.6500 F3600
+G1 X60.735 Y92.368 E45.7000 F3600
+G1 X60.874 Y91.684 E45.7500 F3600
+G1 X61.025 Y91.002 E45.8000 F3600
+G1 X61.188 Y90.323 E45.8500 F3600
+G1 X61.363 Y89.647 E45.9000 F3600
+G1 X61.550 Y88.975 E45.9500 F3600
+G1 X61.748 Y88.305 E46.0000 F3600
+G1 X61.958 Y87.639 E46.0500 F3600
+G1 X62.179 Y86.977 E46.1000 F3600
+G1 X62.412 Y86.319 E46.1500 F3600
+G1 X62.657 Y85.665 E46.2000 F3600
+G1 X62.913 Y85.016 E46.2500 F3600
+G1 X63.180 Y84.371 E46.3000 F3600
+G1 X63.458 Y83.731 E46.3500 F3600
+G1 X63.748 Y83.095 E46.4000 F3600
+G1 X64.048 Y82.465 E46.4500 F3600
+G1 X64.360 Y81.840 E46.5000 F3600
+G1 X64.682 Y81.221 E46.5500 F3600
+G1 X65.015 Y80.608 E46.6000 F3600
+G1 X65.359 Y80.000 E46.6500 F3600
+G1 X65.713 Y79.398 E46.7000 F3600
+G1 X66.078 Y78.803 E46.7500 F3600
+G1 X66.453 Y78.214 E46.8000 F3600
+G1 X66.838 Y77.632 E46.8500 F3600
+G1 X67.234 Y77.057 E46.9000 F3600
+G1 X67.639 Y76.489 E46.9500 F3600
+G1 X68.055 Y75.927 E47.0000 F3600
+G1 X68.480 Y75.374 E47.0500 F3600
+G1 X68.914 Y74.827 E47.1000 F3600
+G1 X69.358 Y74.288 E47.1500 F3600
+G1 X69.812 Y73.758 E47.2000 F3600
+G1 X70.274 Y73.235 E47.2500 F3600
+G1 X70.746 Y72.720 E47.3000 F3600
+G1 X71.226 Y72.214 E47.3500 F3600
+G1 X71.716 Y71.716 E47.4000 F3600
+G1 X72.214 Y71.226 E47.4500 F3600
+G1 X72.720 Y70.746 E47.5000 F3600
+G1 X73.235 Y70.274 E47.5500 F3600
+G1 X73.758 Y69.812 E47.6000 F3600
+G1 X74.288 Y69.358 E47.6500 F3600
+G1 X74.827 Y68.914 E47.7000 F3600
+G1 X75.374 Y68.480 E47.7500 F3600
+G1 X75.927 Y68.055 E47.8000 F3600
+G1 X76.489 Y67.639 E47.8500 F3600
+G1 X77.057 Y67.234 E47.9000 F3600
+G1 X77.632 Y66.838 E47.9500 F3600
+G1 X78.214 Y66.453 E48.0000 F3600
+G1 X78.803 Y66.078 E48.0500 F3600
+G1 X79.398 Y65.713 E48.1000 F3600
+G1 X80.000 Y65.359 E48.1500 F3600
+G1 X80.608 Y65.015 E48.2000 F3600
+G1 X81.221 Y64.682 E48.2500 F3600
+G1 X81.840 Y64.360 E48.3000 F3600
+G1 X82.465 Y64.048 E48.3500 F3600
+G1 X83.095 Y63.748 E48.4000 F3600
+G1 X83.731 Y63.458 E48.4500 F3600
+G1 X84.371 Y63.180 E48.5000 F3600
+G1 X85.016 Y62.913 E48.5500 F3600
+G1 X85.665 Y62.657 E48.6000 F3600
+G1 X86.319 Y62.412 E48.6500 F3600
+G1 X86.977 Y62.179 E48.7000 F3600
+G1 X87.639 Y61.958 E48.7500 F3600
+G1 X88.305 Y61.748 E48.8000 F3600
+G1 X88.975 Y61.550 E48.8500 F3600
+G1 X89.647 Y61.363 E48.9000 F3600
+G1 X90.323 Y61.188 E48.9500 F3600
+G1 X91.002 Y61.025 E49.0000 F3600
+G1 X91.684 Y60.874 E49.0500 F3600
+G1 X92.368 Y60.735 E49.1000 F3600
+G1 X93.054 Y60.608 E49.1500 F3600
+G1 X93.743 Y60.492 E49.2000 F3600
+G1 X94.433 Y60.389 E49.2500 F3600
+G1 X95.125 Y60.298 E49.3000 F3600
+G1 X95.819 Y60.219 E49.3500 F3600
+G1 X96.514 Y60.152 E49.4000 F3600
+G1 X97.210 Y60.097 E49.4500 F3600
+G1 X97.907 Y60.055 E49.5000 F3600
+G1 X98.604 Y60.024 E49.5500 F3600
+G1 X99.302 Y60.006 E49.6000 F3600
+G1 X100.000 Y60.000 E49.6500 F3600
+G1 X100.698 Y60.006 E49.7000 F3600
+G1 X101.396 Y60.024 E49.7500 F3600
+G1 X102.093 Y60.055 E49.8000 F3600
+G1 X102.790 Y60.097 E49.8500 F3600
+G1 X103.486 Y60.152 E49.9000 F3600
+G1 X104.181 Y60.219 E49.9500 F3600
+G1 X104.875 Y60.298 E50.0000 F3600
+G1 X105.567 Y60.389 E50.0500 F3600
+G1 X106.257 Y60.492 E50.1000 F3600
+G1 X106.946 Y60.608 E50.1500 F3600
+G1 X107.632 Y60.735 E50.2000 F3600
+G1 X108.316 Y60.874 E50.2500 F3600
+G1 X108.998 Y61.025 E50.3000 F3600
+G1 X109.677 Y61.188 E50.3500 F3600
+G1 X110.353 Y61.363 E50.4000 F3600
+G1 X111.025 Y61.550 E50.4500 F3600
+G1 X111.695 Y61.748 E50.5000 F3600
+G1 X112.361 Y61.958 E50.5500 F3600
+G1 X113.023 Y62.179 E50.6000 F3600
+G1 X113.681 Y62.412 E50.6500 F3600
+G1 X114.335 Y62.657 E50.7000 F3600
+G1 X114.984 Y62.913 E50.7500 F3600
+G1 X115.629 Y63.180 E50.8000 F3600
+G1 X116.269 Y63.458 E50.8500 F3600
+G1 X116.905 Y63.748 E50.9000 F3600
+G1 X117.535 Y64.048 E50.9500 F3600
+G1 X118.160 Y64.360 E51.0000 F3600
+G1 X118.779 Y64.682 E51.0500 F3600
+G1 X119.392 Y65.015 E51.1000 F3600
+G1 X120.000 Y65.359 E51.1500 F3600
+G1 X120.602 Y65.713 E51.2000 F3600
+G1 X121.197 Y66.078 E51.2500 F3600
+G1 X121.786 Y66.453 E51.3000 F3600
+G1 X122.368 Y66.838 E51.3500 F3600
+G1 X122.943 Y67.234 E51.4000 F3600
+G1 X123.511 Y67.639 E51.4500 F3600
+G1 X124.073 Y68.055 E51.5000 F3600
+G1 X124.626 Y68.480 E51.5500 F3600
+G1 X125.173 Y68.914 E51.6000 F3600
+G1 X125.712 Y69.358 E51.6500 F3600
+G1 X126.242 Y69.812 E51.7000 F3600
+G1 X126.765 Y70.274 E51.7500 F3600
+G1 X127.280 Y70.746 E51.8000 F3600
+G1 X127.786 Y71.226 E51.8500 F3600
+G1 X128.284 Y71.716 E51.9000 F3600
+G1 X128.774 Y72.214 E51.9500 F3600
+G1 X129.254 Y72.720 E52.0000 F3600
+G1 X129.726 Y73.235 E52.0500 F3600
+G1 X130.188 Y73.758 E52.1000 F3600
+G1 X130.642 Y74.288 E52.1500 F3600
+G1 X131.086 Y74.827 E52.2000 F3600
+G1 X131.520 Y75.374 E52.2500 F3600
+G1 X131.945 Y75.927 E52.3000 F3600
+G1 X132.361 Y76.489 E52.3500 F3600
+G1 X132.766 Y77.057 E52.4000 F3600
+G1 X133.162 Y77.632 E52.4500 F3600
+G1 X133.547 Y78.214 E52.5000 F3600
+G1 X133.922 Y78.803 E52.5500 F3600
+G1 X134.287 Y79.398 E52.6000 F3600
+G1 X134.641 Y80.000 E52.6500 F3600
+G1 X134.985 Y80.608 E52.7000 F3600
+G1 X135.318 Y81.221 E52.7500 F3600
+G1 X135.640 Y81.840 E52.8000 F3600
+G1 X135.952 Y82.465 E52.8500 F3600
+G1 X136.252 Y83.095 E52.9000 F3600
+G1 X136.542 Y83.731 E52.9500 F3600
+G1 X136.820 Y84.371 E53.0000 F3600
+G1 X137.087 Y85.016 E53.0500 F3600
+G1 X137.343 Y85.665 E53.1000 F3600
+G1 X137.588 Y86.319 E53.1500 F3600
+G1 X137.821 Y86.977 E53.2000 F3600
+G1 X138.042 Y87.639 E53.2500 F3600
+G1 X138.252 Y88.305 E53.3000 F3600
+G1 X138.450 Y88.975 E53.3500 F3600
+G1 X138.637 Y89.647 E53.4000 F3600
+G1 X138.812 Y90.323 E53.4500 F3600
+G1 X138.975 Y91.002 E53.5000 F3600
+G1 X139.126 Y91.684 E53.5500 F3600
+G1 X139.265 Y92.368 E53.6000 F3600
+G1 X139.392 Y93.054 E53.6500 F3600
+G1 X139.508 Y93.743 E53.7000 F3600
+G1 X139.611 Y94.433 E53.7500 F3600
+G1 X139.702 Y95.125 E53.8000 F3600
+G1 X139.781 Y95.819 E53.8500 F3600
+G1 X139.848 Y96.514 E53.9000 F3600
+G1 X139.903 Y97.210 E53.9500 F3600
+G1 X139.945 Y97.907 E54.0000 F3600
+G1 X139.976 Y98.604 E54.0500 F3600
+G1 X139.994 Y99.302 E54.1000 F3600
+G1 X140.000 Y100.000 E54.1500 F3600
+G1 X10 Y10 F9000 ; travel
+G1 X10 Y10 E54.150 F2400
+G1 X60 Y10 E54.250 F2400
+G1 X10 Y10 E54.350 F2400
+G1 X60 Y10 E54.450 F2400
+G1 X10 Y10 E54.550 F2400
+G1 X60 Y10 E54.650 F2400
+G1 X10 Y10 E54.750 F2400
+G1 X60 Y10 E54.850 F2400
+G1 X10 Y10 E54.950 F2400
+G1 X60 Y10 E55.050 F2400
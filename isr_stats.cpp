@@ -0,0 +1,114 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * Interrupt run time statistics
+ *
+ * The stepper (and LIN_ADVANCE) interrupts are timed with Timer 1, which also
+ * schedules them. The temperature interrupt can be cut short by the stepper
+ * interrupt, which may clear Timer 1, so it is timed in µs with micros(). That
+ * is the free-running Timer 0 plus its overflow count, so it has a coarser 4µs
+ * but never wraps within a run.
+ *
+ * M930 reports the results. M930 R also resets them.
+ */
+
+#include "Marlin.h"
+
+#if ENABLED(ISR_STATISTICS)
+
+#include "isr_stats.h"
+#include "gcode.h"
+
+ISRStats stepper_isr_stats, temp_isr_stats;
+#if ENABLED(LIN_ADVANCE)
+  ISRStats advance_isr_stats;
+#endif
+#if ENABLED(INPUT_SHAPING)
+  ISRStats shaping_isr_stats;
+#endif
+
+void ISRStats::reset() {
+  this->count = this->max_ticks = this->missed = 0;
+  this->min_ticks = 0xFFFF;
+  this->total_ticks = 0;
+  for (uint8_t i = 0; i < ISR_STATS_BUCKETS; i++) this->histogram[i] = 0;
+}
+
+void ISRStats::report(const char * const name, const float tick_us) {
+  // Take a copy, so the interrupt can't change it mid-report
+  ISRStats s;
+  CRITICAL_SECTION_START
+    s = *this;
+  CRITICAL_SECTION_END
+
+  SERIAL_ECHO_START();
+  serialprintPGM(name);
+  SERIAL_ECHOPAIR(" ISR runs:", s.count);
+  if (s.count) {
+    SERIAL_ECHOPAIR(" min:", s.min_ticks * tick_us);
+    SERIAL_ECHOPAIR(" avg:", (float)s.total_ticks / s.count * tick_us);
+    SERIAL_ECHOPAIR(" max:", s.max_ticks * tick_us);
+    SERIAL_ECHOPGM("us");
+  }
+  SERIAL_ECHOLNPAIR(" missed:", s.missed);
+
+  // Histogram, labeled with the upper bound of each bucket
+  SERIAL_ECHO_START();
+  for (uint8_t i = 0; i < ISR_STATS_BUCKETS - 1; i++) {
+    SERIAL_ECHOPAIR(" <", (uint16_t)(((16UL << i) * tick_us) + 0.5));
+    SERIAL_ECHOPAIR("us:", s.histogram[i]);
+  }
+  SERIAL_ECHOPAIR(" >", (uint16_t)(((16UL << (ISR_STATS_BUCKETS - 2)) * tick_us) + 0.5));
+  SERIAL_ECHOLNPAIR("us:", s.histogram[ISR_STATS_BUCKETS - 1]);
+}
+
+/**
+ * M930: Report interrupt run time statistics
+ *
+ *   R  Reset the statistics after the report
+ */
+void gcode_M930() {
+  stepper_isr_stats.report(PSTR("Stepper"), 1000000.0 / (STEPPER_TIMER_RATE));
+  #if ENABLED(LIN_ADVANCE)
+    advance_isr_stats.report(PSTR("Advance"), 1000000.0 / (STEPPER_TIMER_RATE));
+  #endif
+  #if ENABLED(INPUT_SHAPING)
+    shaping_isr_stats.report(PSTR("Shaping"), 1000000.0 / (STEPPER_TIMER_RATE));
+  #endif
+  temp_isr_stats.report(PSTR("Temperature"), 1.0); // Sampled in µs
+
+  if (parser.seen('R')) {
+    CRITICAL_SECTION_START
+      stepper_isr_stats.reset();
+      #if ENABLED(LIN_ADVANCE)
+        advance_isr_stats.reset();
+      #endif
+      #if ENABLED(INPUT_SHAPING)
+        shaping_isr_stats.reset();
+      #endif
+      temp_isr_stats.reset();
+    CRITICAL_SECTION_END
+  }
+}
+
+#endif // ISR_STATISTICS
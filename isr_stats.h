@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef ISR_STATS_H
+#define ISR_STATS_H
+
+#include "MarlinConfig.h"
+
+#if ENABLED(ISR_STATISTICS)
+
+#define ISR_STATS_BUCKETS 8
+
+/**
+ * @brief Interrupt run time statistics
+ * @details Collects the run times of one interrupt handler, in ticks of the
+ * timer used to sample it. Histogram bucket 0 counts runs of under 16 ticks,
+ * each following bucket doubles that, and the last takes everything above.
+ *
+ * To keep the sums in range every count is halved when 'count' is full, so
+ * the average and histogram favor recent runs.
+ */
+class ISRStats {
+  public:
+    uint16_t count,                         // Runs sampled
+             min_ticks, max_ticks,
+             missed,                        // Deadlines missed
+             histogram[ISR_STATS_BUCKETS];
+    uint32_t total_ticks;
+
+    ISRStats() { this->reset(); }
+
+    void reset();
+
+    /**
+     * @brief Print the statistics
+     * @param name    Name of the interrupt, in PROGMEM
+     * @param tick_us Length of one tick in microseconds
+     */
+    void report(const char * const name, const float tick_us);
+
+    // Record one run. Call with interrupts disabled.
+    FORCE_INLINE void sample(const uint16_t ticks) {
+      if (this->count == 0xFFFF) {
+        this->count >>= 1;
+        this->total_ticks >>= 1;
+        for (uint8_t i = 0; i < ISR_STATS_BUCKETS; i++) this->histogram[i] >>= 1;
+      }
+      this->count++;
+      this->total_ticks += ticks;
+      NOMORE(this->min_ticks, ticks);
+      NOLESS(this->max_ticks, ticks);
+
+      uint8_t b = 0;
+      for (uint16_t t = ticks >> 4; t && b < ISR_STATS_BUCKETS - 1; t >>= 1) b++;
+      this->histogram[b]++;
+    }
+
+    FORCE_INLINE void miss() { if (this->missed < 0xFFFF) this->missed++; }
+};
+
+extern ISRStats stepper_isr_stats, temp_isr_stats;
+#if ENABLED(LIN_ADVANCE)
+  extern ISRStats advance_isr_stats;
+#endif
+#if ENABLED(INPUT_SHAPING)
+  extern ISRStats shaping_isr_stats;
+#endif
+
+void gcode_M930();
+
+#endif // ISR_STATISTICS
+
+#endif // ISR_STATS_H
@@ -230,6 +230,7 @@
 #define MSG_PID_BAD_EXTRUDER_NUM            MSG_PID_AUTOTUNE_FAILED " Bad extruder number"
 #define MSG_PID_TEMP_TOO_HIGH               MSG_PID_AUTOTUNE_FAILED " Temperature too high"
 #define MSG_PID_TIMEOUT                     MSG_PID_AUTOTUNE_FAILED " timeout"
+#define MSG_PID_BAD_MODEL                   MSG_PID_AUTOTUNE_FAILED " No model fits"
 #define MSG_BIAS                            " bias: "
 #define MSG_D                               " d: "
 #define MSG_T_MIN                           " min: "
@@ -237,6 +238,11 @@
 #define MSG_KU                              " Ku: "
 #define MSG_TU                              " Tu: "
 #define MSG_CLASSIC_PID                     " Classic PID "
+#define MSG_MODEL_K                         " K: "
+#define MSG_MODEL_T                         " T: "
+#define MSG_MODEL_L                         " L: "
+#define MSG_MODEL_ERROR                     " RMS error: "
+#define MSG_AMIGO_PID                       " AMIGO PID "
 #define MSG_KP                              " Kp: "
 #define MSG_KI                              " Ki: "
 #define MSG_KD                              " Kd: "
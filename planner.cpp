@@ -67,6 +67,10 @@
 #include "ubl.h"
 #include "gcode.h"
 
+#if HAS_COLOR_LEDS
+  #include "leds.h"
+#endif
+
 #include "Marlin.h"
 
 #if ENABLED(MESH_BED_LEVELING)
@@ -82,7 +86,8 @@ Planner planner;
  */
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
 volatile uint8_t Planner::block_buffer_head = 0,           // Index of the next block to be pushed
-                 Planner::block_buffer_tail = 0;
+                 Planner::block_buffer_tail = 0,
+                 Planner::block_buffer_planned = 0;        // Index of the first block that may still be re-planned
 
 float Planner::max_feedrate_mm_s[XYZE_N], // Max speeds in mm per second
       Planner::axis_steps_per_mm[XYZE_N],
@@ -115,6 +120,10 @@ float Planner::min_feedrate_mm_s,
       Planner::max_jerk[XYZE],       // The largest speed change requiring no acceleration
       Planner::min_travel_feedrate_mm_s;
 
+#if ENABLED(JUNCTION_DEVIATION)
+  float Planner::junction_deviation_mm; // Initialized by settings.load()
+#endif
+
 #if HAS_LEVELING
   bool Planner::leveling_active = false; // Flag that auto bed leveling is enabled
   #if ABL_PLANAR
@@ -155,9 +164,45 @@ int32_t Planner::position[NUM_AXIS] = { 0 };
 
 uint32_t Planner::cutoff_long;
 
+bool Planner::defer_recalculate = false;
+
+uint32_t Planner::block_sequence = 0;
+volatile uint32_t Planner::block_sequence_done = 0;
+
+volatile uint8_t Planner::axis_active_blocks[NUM_AXIS] = { 0 };
+
+#if ENABLED(AUTOTEMP)
+  uint8_t Planner::autotemp_block[BLOCK_BUFFER_SIZE],
+          Planner::autotemp_front = 0,
+          Planner::autotemp_back = 0;
+  float Planner::autotemp_speed[BLOCK_BUFFER_SIZE];
+#endif
+
+#if ENABLED(BLOCK_SYNC_EVENTS)
+  sync_event_t Planner::sync_event_buffer[BLOCK_SYNC_EVENT_BUFFER_SIZE];
+  uint8_t Planner::sync_event_head = 0,
+          Planner::sync_event_tail = 0,
+          Planner::sync_events_pending = 0;
+  volatile uint8_t Planner::sync_events_due = 0;
+#endif
+
+#if ENABLED(SEGMENT_MERGE)
+  float Planner::merge_start[XYZE],
+        Planner::merge_end[XYZE],
+        Planner::merge_point[SEGMENT_MERGE_MAX_COUNT - 1][XYZ],
+        Planner::merge_fr_mm_s,
+        Planner::merge_e_per_mm;
+  uint8_t Planner::merge_count = 0,
+          Planner::merge_extruder;
+#endif
+
 float Planner::previous_speed[NUM_AXIS],
       Planner::previous_nominal_speed;
 
+#if ENABLED(JUNCTION_DEVIATION)
+  float Planner::previous_unit_vec[XYZ];
+#endif
+
 #if ENABLED(DISABLE_INACTIVE_EXTRUDER)
   uint8_t Planner::g_uc_extruder_last_move[EXTRUDERS] = { 0 };
 #endif
@@ -177,9 +222,7 @@ float Planner::previous_speed[NUM_AXIS],
         Planner::lin_dist_e;
 #endif
 
-#if ENABLED(ULTRA_LCD)
-  volatile uint32_t Planner::block_buffer_runtime_us = 0;
-#endif
+volatile uint32_t Planner::block_buffer_runtime_us = 0;
 
 /**
  * Class and Instance Methods
@@ -188,13 +231,27 @@ float Planner::previous_speed[NUM_AXIS],
 Planner::Planner() { init(); }
 
 void Planner::init() {
-  block_buffer_head = block_buffer_tail = 0;
+  block_buffer_head = block_buffer_tail = block_buffer_planned = 0;
+  LOOP_XYZE(i) axis_active_blocks[i] = 0;
+  #if ENABLED(AUTOTEMP)
+    autotemp_front = autotemp_back = 0;
+  #endif
+  #if ENABLED(SEGMENT_MERGE)
+    merge_count = 0;
+  #endif
+  #if ENABLED(BLOCK_SYNC_EVENTS)
+    sync_event_head = sync_event_tail = sync_events_pending = sync_events_due = 0;
+  #endif
+  block_sequence = block_sequence_done = 0;
   ZERO(position);
   #if ENABLED(LIN_ADVANCE)
     ZERO(position_float);
   #endif
   ZERO(previous_speed);
   previous_nominal_speed = 0.0;
+  #if ENABLED(JUNCTION_DEVIATION)
+    ZERO(previous_unit_vec);
+  #endif
   #if ABL_PLANAR
     bed_level_matrix.set_to_identity();
   #endif
@@ -214,7 +271,8 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   NOLESS(initial_rate, MINIMAL_STEP_RATE);
   NOLESS(final_rate, MINIMAL_STEP_RATE);
 
-  const int32_t accel = block->acceleration_steps_per_s2;
+  // The acceleration in steps/sec^2, from the rate the Stepper ISR uses
+  const float accel = block->acceleration_rate * float((STEPPER_TIMER_RATE) / 16777216.0);
 
           // Steps required for acceleration, deceleration to/from nominal rate
   int32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
@@ -226,13 +284,41 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
   // Then we can't possibly reach the nominal rate, there will be no cruising.
   // Use intersection_distance() to calculate accel / braking time in order to
   // reach the final_rate exactly at the end of this block.
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint32_t cruise_rate = block->nominal_rate;
+  #endif
   if (plateau_steps < 0) {
     accelerate_steps = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
     NOLESS(accelerate_steps, 0); // Check limits due to numerical round-off
     accelerate_steps = min((uint32_t)accelerate_steps, block->step_event_count);//(We can cast here to unsigned, because the above line ensures that we are above zero)
     plateau_steps = 0;
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // The nominal rate won't be reached. Use the peak rate as the cruise rate.
+      cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      NOMORE(cruise_rate, block->nominal_rate);
+      NOLESS(cruise_rate, initial_rate);
+    #endif
   }
 
+  #if ENABLED(S_CURVE_ACCELERATION)
+    // The S-curve is evaluated against time, not steps. It spans the same time (and
+    // so the same distance) as the trapezoid ramp, so the step indexes still apply.
+    const uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
+                   deceleration_time = ((float)(cruise_rate - min(final_rate, cruise_rate)) / accel) * (STEPPER_TIMER_RATE),
+                   acceleration_time_inverse = get_period_inverse(acceleration_time),
+                   deceleration_time_inverse = get_period_inverse(deceleration_time);
+  #endif
+
+  #if ENABLED(LIN_ADVANCE)
+    // Pressure is proportional to the speed, so scale it like the rates
+    const uint16_t final_adv_steps = TEST(block->flag, BLOCK_BIT_USE_ADVANCE_LEAD) ? block->max_adv_steps * exit_factor : 0;
+  #endif
+
+  // Timer interval for the initial rate, used by the Stepper ISR at block start
+  uint8_t initial_step_loops = 0; // Any number of steps per ISR
+  const uint16_t initial_timer = stepper.calc_timer_interval(initial_rate, initial_step_loops);
+
   // block->accelerate_until = accelerate_steps;
   // block->decelerate_after = accelerate_steps+plateau_steps;
 
@@ -241,7 +327,19 @@ void Planner::calculate_trapezoid_for_block(block_t* const block, const float &e
     block->accelerate_until = accelerate_steps;
     block->decelerate_after = accelerate_steps + plateau_steps;
     block->initial_rate = initial_rate;
+    block->initial_timer = initial_timer;
+    block->initial_step_loops = initial_step_loops;
     block->final_rate = final_rate;
+    #if ENABLED(LIN_ADVANCE)
+      block->final_adv_steps = final_adv_steps;
+    #endif
+    #if ENABLED(S_CURVE_ACCELERATION)
+      block->cruise_rate = cruise_rate;
+      block->acceleration_time = acceleration_time;
+      block->deceleration_time = deceleration_time;
+      block->acceleration_time_inverse = acceleration_time_inverse;
+      block->deceleration_time_inverse = deceleration_time_inverse;
+    #endif
   }
   CRITICAL_SECTION_END;
 }
@@ -267,7 +365,7 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
     // for max allowable speed if block is decelerating and nominal length is false.
     current->entry_speed = (TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH) || max_entry_speed <= next->entry_speed)
       ? max_entry_speed
-      : min(max_entry_speed, max_allowable_speed(-current->acceleration, next->entry_speed, current->millimeters));
+      : min(max_entry_speed, max_allowable_speed(current->max_speed_sqr_change, next->entry_speed));
     SBI(current->flag, BLOCK_BIT_RECALCULATE);
   }
 }
@@ -275,69 +373,82 @@ void Planner::reverse_pass_kernel(block_t* const current, const block_t * const
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * Only the blocks after block_buffer_planned are visited. Everything before
+ * it is already optimal, so the cost of adding a segment stays constant on
+ * average instead of growing with the length of the buffer.
  */
 void Planner::reverse_pass() {
-  if (movesplanned() > 3) {
-    const uint8_t endnr = BLOCK_MOD(block_buffer_tail + 2); // tail is running. tail+1 shouldn't be altered because it's connected to the running block.
-                                                            // tail+2 because the index is not yet advanced when checked
-    uint8_t blocknr = prev_block_index(block_buffer_head);
-    block_t* current = &block_buffer[blocknr];
-
-    do {
-      const block_t * const next = current;
-      blocknr = prev_block_index(blocknr);
-      current = &block_buffer[blocknr];
-      if (TEST(current->flag, BLOCK_BIT_START_FROM_FULL_HALT)) // Up to this every block is already optimized.
-        break;
-      reverse_pass_kernel(current, next);
-    } while (blocknr != endnr);
+  uint8_t blocknr = block_buffer_head;
+  const block_t *next = NULL;
+
+  // block_buffer_planned may be pushed forward by the Stepper ISR, so re-read it every step.
+  // A busy block means the ISR got there first, so stop in that case too.
+  while (blocknr != block_buffer_planned) {
+    blocknr = prev_block_index(blocknr);
+    block_t * const current = &block_buffer[blocknr];
+    if (blocknr == block_buffer_planned || TEST(current->flag, BLOCK_BIT_BUSY)) break;
+    reverse_pass_kernel(current, next);
+    next = current;
   }
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
-void Planner::forward_pass_kernel(const block_t * const previous, block_t* const current) {
+void Planner::forward_pass_kernel(const block_t * const previous, block_t* const current, const uint8_t block_index) {
   if (!previous) return;
 
   // If the previous block is an acceleration block, but it is not long enough to complete the
   // full speed change within the block, we need to adjust the entry speed accordingly. Entry
   // speeds have already been reset, maximized, and reverse planned by reverse planner.
   // If nominal length is true, max junction speed is guaranteed to be reached. No need to recheck.
+  bool optimal = false;
   if (!TEST(previous->flag, BLOCK_BIT_NOMINAL_LENGTH)) {
     if (previous->entry_speed < current->entry_speed) {
-      float entry_speed = min(current->entry_speed,
-                               max_allowable_speed(-previous->acceleration, previous->entry_speed, previous->millimeters));
+      const float max_entry_speed = max_allowable_speed(previous->max_speed_sqr_change, previous->entry_speed);
       // Check for junction speed change
-      if (current->entry_speed != entry_speed) {
-        current->entry_speed = entry_speed;
+      if (max_entry_speed < current->entry_speed) {
+        current->entry_speed = max_entry_speed;
         SBI(current->flag, BLOCK_BIT_RECALCULATE);
+        optimal = true; // Full acceleration into this block can't be improved upon
       }
     }
   }
+
+  // A block entered at its maximum entry speed can't be improved by any later block either.
+  // Once bracketed like this, the blocks behind it never need to be planned again.
+  if (optimal || current->entry_speed == current->max_entry_speed) {
+    CRITICAL_SECTION_START;
+      if (!TEST(current->flag, BLOCK_BIT_BUSY)) block_buffer_planned = block_index;
+    CRITICAL_SECTION_END;
+  }
 }
 
 /**
  * recalculate() needs to go over the current plan twice.
- * Once in reverse and once forward. This implements the forward pass.
+ * Once in reverse and once forward. This implements the forward pass,
+ * which also advances block_buffer_planned past every optimal block.
  */
 void Planner::forward_pass() {
-  block_t* block[3] = { NULL, NULL, NULL };
-
-  for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
-    block[0] = block[1];
-    block[1] = block[2];
-    block[2] = &block_buffer[b];
-    forward_pass_kernel(block[0], block[1]);
+  uint8_t block_index = block_buffer_planned;
+  if (block_index == block_buffer_head) return;
+
+  const block_t *previous = &block_buffer[block_index];
+  for (block_index = next_block_index(block_index); block_index != block_buffer_head; block_index = next_block_index(block_index)) {
+    block_t * const current = &block_buffer[block_index];
+    // Once the previous block is busy its exit speed can no longer change
+    if (!TEST(previous->flag, BLOCK_BIT_BUSY)) forward_pass_kernel(previous, current, block_index);
+    previous = current;
   }
-  forward_pass_kernel(block[1], block[2]);
 }
 
 /**
- * Recalculate the trapezoid speed profiles for all blocks in the plan
+ * Recalculate the trapezoid speed profiles for the blocks in the plan
  * according to the entry_factor for each junction. Must be called by
- * recalculate() after updating the blocks.
+ * recalculate() after updating the blocks, with the index the passes
+ * started from. Blocks before that index were not touched.
  */
-void Planner::recalculate_trapezoids() {
-  int8_t block_index = block_buffer_tail;
+void Planner::recalculate_trapezoids(const uint8_t first_block_index) {
+  int8_t block_index = first_block_index;
   block_t *current, *next = NULL;
 
   while (block_index != block_buffer_head) {
@@ -387,28 +498,46 @@ void Planner::recalculate_trapezoids() {
  *   3. Recalculate "trapezoids" for all blocks.
  */
 void Planner::recalculate() {
+  const uint8_t first_block_index = block_buffer_planned;
   reverse_pass();
   forward_pass();
-  recalculate_trapezoids();
+  recalculate_trapezoids(first_block_index);
 }
 
 
 #if ENABLED(AUTOTEMP)
 
+  /**
+   * Drop blocks the Stepper ISR has discarded from the front of the E speed list.
+   * Those are the blocks no longer between tail and head. A discarded block's
+   * index can't be queued again before this runs, since autotemp_push prunes
+   * before it adds a block.
+   */
+  void Planner::autotemp_prune() {
+    const uint8_t tail = block_buffer_tail, queued = BLOCK_MOD(block_buffer_head - tail);
+    while (autotemp_front != autotemp_back && BLOCK_MOD(autotemp_block[autotemp_front] - tail) >= queued)
+      autotemp_front = next_block_index(autotemp_front);
+  }
+
+  // Add a block about to be queued. Earlier blocks that are no faster can never be the fastest again.
+  void Planner::autotemp_push(const uint8_t block_index, const float &e_speed) {
+    autotemp_prune();
+    while (autotemp_back != autotemp_front && autotemp_speed[prev_block_index(autotemp_back)] <= e_speed)
+      autotemp_back = prev_block_index(autotemp_back);
+    autotemp_block[autotemp_back] = block_index;
+    autotemp_speed[autotemp_back] = e_speed;
+    autotemp_back = next_block_index(autotemp_back);
+  }
+
   void Planner::getHighESpeed() {
     static float oldt = 0;
 
     if (!autotemp_enabled) return;
     if (thermalManager.degTargetHotend(0) + 2 < autotemp_min) return; // probably temperature set to zero.
 
-    float high = 0.0;
-    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
-      block_t* block = &block_buffer[b];
-      if (block->steps[X_AXIS] || block->steps[Y_AXIS] || block->steps[Z_AXIS]) {
-        float se = (float)block->steps[E_AXIS] / block->step_event_count * block->nominal_speed; // mm/sec;
-        NOLESS(high, se);
-      }
-    }
+    // The fastest queued block is at the front
+    autotemp_prune();
+    const float high = autotemp_front != autotemp_back ? autotemp_speed[autotemp_front] : 0.0;
 
     float t = autotemp_min + high * autotemp_factor;
     t = constrain(t, autotemp_min, autotemp_max);
@@ -423,8 +552,7 @@ void Planner::recalculate() {
  * Maintain fans, paste extruder pressure,
  */
 void Planner::check_axes_activity() {
-  unsigned char axis_active[NUM_AXIS] = { 0 },
-                tail_fan_speed[FAN_COUNT];
+  unsigned char tail_fan_speed[FAN_COUNT];
 
   #if ENABLED(BARICUDA)
     #if HAS_HEATER_1
@@ -435,6 +563,15 @@ void Planner::check_axes_activity() {
     #endif
   #endif
 
+  #if ENABLED(SEGMENT_MERGE)
+    // Don't let a held move starve the steppers
+    if (movesplanned() < 2) flush_merged_segment();
+  #endif
+
+  #if ENABLED(BLOCK_SYNC_EVENTS)
+    apply_sync_events();
+  #endif
+
   if (blocks_queued()) {
 
     #if FAN_COUNT > 0
@@ -442,10 +579,8 @@ void Planner::check_axes_activity() {
         tail_fan_speed[i] = block_buffer[block_buffer_tail].fan_speed[i];
     #endif
 
-    block_t* block;
-
     #if ENABLED(BARICUDA)
-      block = &block_buffer[block_buffer_tail];
+      block_t* block = &block_buffer[block_buffer_tail];
       #if HAS_HEATER_1
         tail_valve_pressure = block->valve_pressure;
       #endif
@@ -453,11 +588,6 @@ void Planner::check_axes_activity() {
         tail_e_to_p_pressure = block->e_to_p_pressure;
       #endif
     #endif
-
-    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
-      block = &block_buffer[b];
-      LOOP_XYZE(i) if (block->steps[i]) axis_active[i]++;
-    }
   }
   else {
     #if FAN_COUNT > 0
@@ -475,16 +605,16 @@ void Planner::check_axes_activity() {
   }
 
   #if ENABLED(DISABLE_X)
-    if (!axis_active[X_AXIS]) disable_X();
+    if (!axis_active_blocks[X_AXIS]) disable_X();
   #endif
   #if ENABLED(DISABLE_Y)
-    if (!axis_active[Y_AXIS]) disable_Y();
+    if (!axis_active_blocks[Y_AXIS]) disable_Y();
   #endif
   #if ENABLED(DISABLE_Z)
-    if (!axis_active[Z_AXIS]) disable_Z();
+    if (!axis_active_blocks[Z_AXIS]) disable_Z();
   #endif
   #if ENABLED(DISABLE_E)
-    if (!axis_active[E_AXIS]) disable_e_steppers();
+    if (!axis_active_blocks[E_AXIS]) disable_e_steppers();
   #endif
 
   #if FAN_COUNT > 0
@@ -795,7 +925,16 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
 
   // If the buffer is full: good! That means we are well ahead of the robot.
   // Rest here until there is room in the buffer.
-  while (block_buffer_tail == next_buffer_head) idle();
+  if (block_buffer_tail == next_buffer_head) {
+    // A batch must be planned before waiting, so the steppers have something to run
+    if (defer_recalculate) recalculate();
+    while (block_buffer_tail == next_buffer_head) {
+      #if ENABLED(STEP_SEGMENT_BUFFER)
+        stepper.prep_segments();
+      #endif
+      idle();
+    }
+  }
 
   // Prepare to set up new block
   block_t* block = &block_buffer[block_buffer_head];
@@ -848,6 +987,12 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
     block->e_to_p_pressure = baricuda_e_to_p_pressure;
   #endif
 
+  #if ENABLED(BLOCK_SYNC_EVENTS)
+    // State changes added since the last block happen as this one starts
+    block->sync_events = sync_events_pending;
+    sync_events_pending = 0;
+  #endif
+
   block->active_extruder = extruder;
 
   //enable active axes
@@ -1016,11 +1161,12 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
   #endif
   delta_mm[E_AXIS] = esteps_float * steps_to_mm[E_AXIS_N];
 
+  float millimeters; // The total travel of this block in mm
   if (block->steps[X_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[Y_AXIS] < MIN_STEPS_PER_SEGMENT && block->steps[Z_AXIS] < MIN_STEPS_PER_SEGMENT) {
-    block->millimeters = FABS(delta_mm[E_AXIS]);
+    millimeters = FABS(delta_mm[E_AXIS]);
   }
   else {
-    block->millimeters = SQRT(
+    millimeters = SQRT(
       #if CORE_IS_XY
         sq(delta_mm[X_HEAD]) + sq(delta_mm[Y_HEAD]) + sq(delta_mm[Z_AXIS])
       #elif CORE_IS_XZ
@@ -1032,7 +1178,7 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
       #endif
     );
   }
-  const float inverse_millimeters = 1.0 / block->millimeters;  // Inverse millimeters to remove multiple divides
+  const float inverse_millimeters = 1.0 / millimeters;  // Inverse millimeters to remove multiple divides
 
   // Calculate inverse time for this move. No divide by zero due to previous checks.
   // Example: At 120mm/s a 60mm move takes 0.5s. So this will give 2.0.
@@ -1040,32 +1186,24 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
 
   const uint8_t moves_queued = movesplanned();
 
-  // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
-  #if ENABLED(SLOWDOWN) || ENABLED(ULTRA_LCD) || defined(XY_FREQUENCY_LIMIT)
-    // Segment time im micro seconds
-    uint32_t segment_time_us = LROUND(1000000.0 / inverse_secs);
-  #endif
+  // Segment time im micro seconds
+  uint32_t segment_time_us = LROUND(1000000.0 / inverse_secs);
 
+  // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
   #if ENABLED(SLOWDOWN)
-    if (WITHIN(moves_queued, 2, (BLOCK_BUFFER_SIZE) / 2 - 1)) {
-      if (segment_time_us < min_segment_time_us) {
-        // buffer is draining, add extra time.  The amount of time added increases if the buffer is still emptied more.
-        const uint32_t nst = segment_time_us + LROUND(2 * (min_segment_time_us - segment_time_us) / moves_queued);
+    if (moves_queued > 1 && segment_time_us < min_segment_time_us) {
+      const uint32_t buffered_us = buffered_time_us();
+      if (buffered_us < SLOWDOWN_BUFFER_US) {
+        // Less than the watermark is queued, add extra time. The amount of time added
+        // grows towards min_segment_time_us as the queued time drops towards zero.
+        const uint32_t nst = segment_time_us + LROUND((min_segment_time_us - segment_time_us) * ((SLOWDOWN_BUFFER_US - buffered_us) * (1.0 / (SLOWDOWN_BUFFER_US))));
         inverse_secs = 1000000.0 / nst;
-        #if defined(XY_FREQUENCY_LIMIT) || ENABLED(ULTRA_LCD)
-          segment_time_us = nst;
-        #endif
+        segment_time_us = nst;
       }
     }
   #endif
 
-  #if ENABLED(ULTRA_LCD)
-    CRITICAL_SECTION_START
-      block_buffer_runtime_us += segment_time_us;
-    CRITICAL_SECTION_END
-  #endif
-
-  block->nominal_speed = block->millimeters * inverse_secs;           //   (mm/sec) Always > 0
+  block->nominal_speed = millimeters * inverse_secs;                 //   (mm/sec) Always > 0
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
@@ -1150,13 +1288,31 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
     }
   #endif // XY_FREQUENCY_LIMIT
 
+  #if ENABLED(INPUT_SHAPING)
+    // Don't let X and Y steps outrun the shaping buffer
+    if ((block->steps[X_AXIS] || block->steps[Y_AXIS]) && block->nominal_rate * speed_factor > stepper.shaping_max_rate)
+      NOMORE(speed_factor, (float)stepper.shaping_max_rate / block->nominal_rate);
+  #endif
+
   // Correct the speed
   if (speed_factor < 1.0) {
     LOOP_XYZE(i) current_speed[i] *= speed_factor;
     block->nominal_speed *= speed_factor;
     block->nominal_rate *= speed_factor;
+    segment_time_us = LROUND(1000000.0 / (inverse_secs * speed_factor));
   }
 
+  // The final duration, for the slowdown and the LCD's remaining time
+  block->segment_time_us = segment_time_us;
+  CRITICAL_SECTION_START
+    block_buffer_runtime_us += segment_time_us;
+  CRITICAL_SECTION_END
+
+  // The nominal rate is now final. Look up its timer interval so the Stepper ISR doesn't have to.
+  uint8_t nominal_step_loops = 0; // Any number of steps per ISR
+  block->nominal_timer = stepper.calc_timer_interval(block->nominal_rate, nominal_step_loops);
+  block->nominal_step_loops = nominal_step_loops;
+
   // Compute and limit the acceleration rate for the trapezoid generator.
   const float steps_per_mm = block->step_event_count * inverse_millimeters;
   uint32_t accel;
@@ -1202,60 +1358,78 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
       LIMIT_ACCEL_FLOAT(E_AXIS, ACCEL_IDX);
     }
   }
-  block->acceleration_steps_per_s2 = accel;
-  block->acceleration = accel / steps_per_mm;
-  block->acceleration_rate = (long)(accel * 16777216.0 / ((F_CPU) * 0.125)); // * 8.388608
 
-  // Initial limit on the segment entry velocity
-  float vmax_junction;
-
-  #if 0  // Use old jerk for now
-
-    float junction_deviation = 0.1;
+  #if ENABLED(LIN_ADVANCE)
+    /**
+     *
+     * Use LIN_ADVANCE for blocks if all these are true:
+     *
+     * esteps && (block->steps[X_AXIS] || block->steps[Y_AXIS]) : This is a print move
+     *
+     * extruder_advance_k                 : There is an advance factor set.
+     *
+     * esteps != block->step_event_count  : A problem occurs if the move before a retract is too small.
+     *                                      In that case, the retract and move will be executed together.
+     *                                      This leads to too many advance steps due to a huge e_acceleration.
+     *                                      The math is good, but we must avoid retract moves with advance!
+     * lin_dist_e > 0                       : Extruder is running forward (e.g., for "Wipe while retracting" (Slic3r) or "Combing" (Cura) moves)
+     */
+    if (esteps && (block->steps[X_AXIS] || block->steps[Y_AXIS])
+        && extruder_advance_k
+        && (uint32_t)esteps != block->step_event_count
+        && lin_dist_e > 0
+    ) {
+      SBI(block->flag, BLOCK_BIT_USE_ADVANCE_LEAD);
+
+      // Pressure advance E steps per mm/s of block speed
+      const float adv_steps_per_mm_s = extruder_advance_k * (1.0 / 512.0)
+        * (UNEAR_ZERO(advance_ed_ratio) ? lin_dist_e / lin_dist_xy : advance_ed_ratio) // Use the fixed ratio, if set
+        * axis_steps_per_mm[E_AXIS_N];
 
-    // Compute path unit vector
-    double unit_vec[XYZ] = {
-      delta_mm[X_AXIS] * inverse_millimeters,
-      delta_mm[Y_AXIS] * inverse_millimeters,
-      delta_mm[Z_AXIS] * inverse_millimeters
-    };
+      // The pressure ramps with the speed, so its steps come at a constant rate while the
+      // speed changes. Limit the acceleration so that rate stays within the E max feedrate.
+      const float max_accel = max_feedrate_mm_s[E_AXIS_N] * axis_steps_per_mm[E_AXIS_N] / adv_steps_per_mm_s * steps_per_mm;
+      if (accel > max_accel) accel = max_accel;
 
-    /*
-       Compute maximum allowable entry speed at junction by centripetal acceleration approximation.
+      const float adv_step_rate = adv_steps_per_mm_s * accel / steps_per_mm;
+      block->advance_speed = adv_step_rate > (STEPPER_TIMER_RATE) / 65534.0 ? (STEPPER_TIMER_RATE) / adv_step_rate : 65534;
+      block->max_adv_steps = min(adv_steps_per_mm_s * block->nominal_speed, 65535.0);
+      block->final_adv_steps = 0;
+    }
 
-       Let a circle be tangent to both previous and current path line segments, where the junction
-       deviation is defined as the distance from the junction to the closest edge of the circle,
-       collinear with the circle center.
+  #endif // LIN_ADVANCE
 
-       The circular segment joining the two paths represents the path of centripetal acceleration.
-       Solve for max velocity based on max acceleration about the radius of the circle, defined
-       indirectly by junction deviation.
+  const float acceleration = accel / steps_per_mm; // mm/sec^2
+  block->max_speed_sqr_change = 2 * acceleration * millimeters;
+  block->acceleration_rate = (long)(accel * 16777216.0 / (STEPPER_TIMER_RATE)); // * 8.388608 at 2MHz
 
-       This may be also viewed as path width or max_jerk in the previous grbl version. This approach
-       does not actually deviate from path, but used as a robust way to compute cornering speeds, as
-       it takes into account the nonlinearities of both the junction angle and junction velocity.
-     */
+  // Initial limit on the segment entry velocity
+  float vmax_junction;
 
-    vmax_junction = MINIMUM_PLANNER_SPEED; // Set default max junction speed
+  #if ENABLED(JUNCTION_DEVIATION)
 
-    // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
-    if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
-      // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
-      // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
-      const float cos_theta = - previous_unit_vec[X_AXIS] * unit_vec[X_AXIS]
-                              - previous_unit_vec[Y_AXIS] * unit_vec[Y_AXIS]
-                              - previous_unit_vec[Z_AXIS] * unit_vec[Z_AXIS];
-      // Skip and use default max junction speed for 0 degree acute junction.
-      if (cos_theta < 0.95) {
-        vmax_junction = min(previous_nominal_speed, block->nominal_speed);
-        // Skip and avoid divide by zero for straight junctions at 180 degrees. Limit to min() of nominal speeds.
-        if (cos_theta > -0.95) {
-          // Compute maximum junction velocity based on maximum acceleration and junction deviation
-          float sin_theta_d2 = SQRT(0.5 * (1.0 - cos_theta)); // Trig half angle identity. Always positive.
-          NOMORE(vmax_junction, SQRT(block->acceleration * junction_deviation * sin_theta_d2 / (1.0 - sin_theta_d2)));
-        }
-      }
+    // Compute path unit vector. E-only moves have no direction in XYZ.
+    float unit_vec[XYZ] = { 0.0 };
+    if (block->steps[X_AXIS] >= MIN_STEPS_PER_SEGMENT || block->steps[Y_AXIS] >= MIN_STEPS_PER_SEGMENT || block->steps[Z_AXIS] >= MIN_STEPS_PER_SEGMENT) {
+      #if CORE_IS_XY
+        unit_vec[X_AXIS] = delta_mm[X_HEAD] * inverse_millimeters;
+        unit_vec[Y_AXIS] = delta_mm[Y_HEAD] * inverse_millimeters;
+        unit_vec[Z_AXIS] = delta_mm[Z_AXIS] * inverse_millimeters;
+      #elif CORE_IS_XZ
+        unit_vec[X_AXIS] = delta_mm[X_HEAD] * inverse_millimeters;
+        unit_vec[Y_AXIS] = delta_mm[Y_AXIS] * inverse_millimeters;
+        unit_vec[Z_AXIS] = delta_mm[Z_HEAD] * inverse_millimeters;
+      #elif CORE_IS_YZ
+        unit_vec[X_AXIS] = delta_mm[X_AXIS] * inverse_millimeters;
+        unit_vec[Y_AXIS] = delta_mm[Y_HEAD] * inverse_millimeters;
+        unit_vec[Z_AXIS] = delta_mm[Z_HEAD] * inverse_millimeters;
+      #else
+        unit_vec[X_AXIS] = delta_mm[X_AXIS] * inverse_millimeters;
+        unit_vec[Y_AXIS] = delta_mm[Y_AXIS] * inverse_millimeters;
+        unit_vec[Z_AXIS] = delta_mm[Z_AXIS] * inverse_millimeters;
+      #endif
     }
+
   #endif
 
   /**
@@ -1265,8 +1439,10 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
    * Start with a safe speed (from which the machine may halt to stop immediately).
    */
 
-  // Exit speed limited by a jerk to full halt of a previous last segment
-  static float previous_safe_speed;
+  #if DISABLED(JUNCTION_DEVIATION)
+    // Exit speed limited by a jerk to full halt of a previous last segment
+    static float previous_safe_speed;
+  #endif
 
   float safe_speed = block->nominal_speed;
   uint8_t limited = 0;
@@ -1284,6 +1460,53 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
     }
   }
 
+  #if ENABLED(JUNCTION_DEVIATION)
+
+    /**
+     * Compute maximum allowable entry speed at junction by centripetal acceleration approximation.
+     *
+     * Let a circle be tangent to both previous and current path line segments, where the junction
+     * deviation is defined as the distance from the junction to the closest edge of the circle,
+     * collinear with the circle center. The circular segment joining the two paths represents the
+     * path of centripetal acceleration. Solve for max velocity based on max acceleration about the
+     * radius of the circle, defined indirectly by junction deviation.
+     *
+     * This does not actually deviate from the path, but is a robust way to compute cornering speeds,
+     * as it takes into account the nonlinearities of both the junction angle and junction velocity.
+     */
+
+    // Skip first block, E-only moves, or when previous_nominal_speed is used as a flag for homing and offset cycles.
+    if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)
+        && (unit_vec[X_AXIS] || unit_vec[Y_AXIS] || unit_vec[Z_AXIS])
+        && (previous_unit_vec[X_AXIS] || previous_unit_vec[Y_AXIS] || previous_unit_vec[Z_AXIS])
+    ) {
+      // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
+      // NOTE: Max junction velocity is computed without sin() or acos() by trig half angle identity.
+      float cos_theta = - previous_unit_vec[X_AXIS] * unit_vec[X_AXIS]
+                        - previous_unit_vec[Y_AXIS] * unit_vec[Y_AXIS]
+                        - previous_unit_vec[Z_AXIS] * unit_vec[Z_AXIS];
+
+      // Full reversal: the move must come to a stop at the junction
+      if (cos_theta > 0.999999)
+        vmax_junction = MINIMUM_PLANNER_SPEED;
+      else {
+        NOLESS(cos_theta, -0.999999); // Avoid divide by zero for straight junctions
+        const float sin_theta_d2 = SQRT(0.5 * (1.0 - cos_theta)); // Trig half angle identity. Always positive.
+        vmax_junction = SQRT(acceleration * junction_deviation_mm * sin_theta_d2 / (1.0 - sin_theta_d2));
+      }
+
+      // The junction velocity will be shared between successive segments. Limit the junction velocity to their minimum.
+      NOMORE(vmax_junction, min(block->nominal_speed, previous_nominal_speed));
+    }
+    else {
+      SBI(block->flag, BLOCK_BIT_START_FROM_FULL_HALT);
+      vmax_junction = safe_speed;
+    }
+
+    COPY(previous_unit_vec, unit_vec);
+
+  #else // !JUNCTION_DEVIATION
+
   if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
     // Estimate a maximum velocity allowed at a joint of two successive segments.
     // If this maximum velocity allowed is lower than the minimum of the entry / exit safe velocities,
@@ -1336,11 +1559,13 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
     vmax_junction = safe_speed;
   }
 
+  #endif // !JUNCTION_DEVIATION
+
   // Max entry speed of this block equals the max exit speed of the previous block.
   block->max_entry_speed = vmax_junction;
 
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable = max_allowable_speed(-block->acceleration, MINIMUM_PLANNER_SPEED, block->millimeters);
+  const float v_allowable = max_allowable_speed(block->max_speed_sqr_change, MINIMUM_PLANNER_SPEED);
   // If stepper ISR is disabled, this indicates buffer_segment wants to add a split block.
   // In this case start with the max. allowed speed to avoid an interrupted first move.
   block->entry_speed = TEST(TIMSK1, OCIE1A) ? MINIMUM_PLANNER_SPEED : min(vmax_junction, v_allowable);
@@ -1358,50 +1583,38 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
   // Update previous path unit_vector and nominal speed
   COPY(previous_speed, current_speed);
   previous_nominal_speed = block->nominal_speed;
-  previous_safe_speed = safe_speed;
+  #if DISABLED(JUNCTION_DEVIATION)
+    previous_safe_speed = safe_speed;
+  #endif
 
-  #if ENABLED(LIN_ADVANCE)
-    /**
-     *
-     * Use LIN_ADVANCE for blocks if all these are true:
-     *
-     * esteps && (block->steps[X_AXIS] || block->steps[Y_AXIS]) : This is a print move
-     *
-     * extruder_advance_k                 : There is an advance factor set.
-     *
-     * esteps != block->step_event_count  : A problem occurs if the move before a retract is too small.
-     *                                      In that case, the retract and move will be executed together.
-     *                                      This leads to too many advance steps due to a huge e_acceleration.
-     *                                      The math is good, but we must avoid retract moves with advance!
-     * lin_dist_e > 0                       : Extruder is running forward (e.g., for "Wipe while retracting" (Slic3r) or "Combing" (Cura) moves)
-     */
-    block->use_advance_lead =  esteps && (block->steps[X_AXIS] || block->steps[Y_AXIS])
-                            && extruder_advance_k
-                            && (uint32_t)esteps != block->step_event_count
-                            && lin_dist_e > 0;
-    if (block->use_advance_lead)
-      block->abs_adv_steps_multiplier8 = LROUND(
-        extruder_advance_k
-        * (UNEAR_ZERO(advance_ed_ratio) ? lin_dist_e / lin_dist_xy : advance_ed_ratio) // Use the fixed ratio, if set
-        * (block->nominal_speed / (float)block->nominal_rate)
-        * axis_steps_per_mm[E_AXIS_N] * 256.0
-      );
+  #if ENABLED(AUTOTEMP)
+    if (block->steps[X_AXIS] || block->steps[Y_AXIS] || block->steps[Z_AXIS])
+      autotemp_push(block_buffer_head, (float)block->steps[E_AXIS] / block->step_event_count * block->nominal_speed); // mm/sec
+  #endif
 
-  #endif // LIN_ADVANCE
+  // Count the axes this block moves. The ISR counts down, so don't let it in.
+  {
+    CRITICAL_SECTION_START
+      LOOP_XYZE(i) if (block->steps[i]) axis_active_blocks[i]++;
+    CRITICAL_SECTION_END
+  }
 
   // Move buffer head
+  block_sequence++;
   block_buffer_head = next_buffer_head;
 
   // Update the position (only when a move was queued)
   static_assert(COUNT(target) > 1, "Parameter to _buffer_steps must be (&target)[XYZE]!");
   COPY(position, target);
 
-  recalculate();
+  // In a batch, put off planning until the end. The Stepper ISR won't start
+  // an unplanned block, so plan right away if it's one of the next two.
+  if (!defer_recalculate || movesplanned() <= 2) recalculate();
 
 } // _buffer_steps()
 
 /**
- * Planner::buffer_segment
+ * Planner::_buffer_segment
  *
  * Add a new linear movement to the buffer in axis units.
  *
@@ -1411,7 +1624,7 @@ void Planner::_buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const
  *  fr_mm_s   - (target) speed of the move
  *  extruder  - target extruder
  */
-void Planner::buffer_segment(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder) {
+void Planner::_buffer_segment(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder) {
   // When changing extruders recalculate steps corresponding to the E position
   #if ENABLED(DISTINCT_E_FACTORS)
     if (last_extruder != extruder && axis_steps_per_mm[E_AXIS_N] != axis_steps_per_mm[E_AXIS + last_extruder]) {
@@ -1423,10 +1636,10 @@ void Planner::buffer_segment(const float &a, const float &b, const float &c, con
   // The target position of the tool in absolute steps
   // Calculate target position in absolute steps
   const int32_t target[XYZE] = {
-    LROUND(a * axis_steps_per_mm[X_AXIS]),
-    LROUND(b * axis_steps_per_mm[Y_AXIS]),
-    LROUND(c * axis_steps_per_mm[Z_AXIS]),
-    LROUND(e * axis_steps_per_mm[E_AXIS_N])
+    int32_t(LROUND(a * axis_steps_per_mm[X_AXIS])),
+    int32_t(LROUND(b * axis_steps_per_mm[Y_AXIS])),
+    int32_t(LROUND(c * axis_steps_per_mm[Z_AXIS])),
+    int32_t(LROUND(e * axis_steps_per_mm[E_AXIS_N]))
   };
 
   // DRYRUN prevents E moves from taking place
@@ -1472,7 +1685,7 @@ void Planner::buffer_segment(const float &a, const float &b, const float &c, con
   #endif
 
   /* <-- add a slash to enable
-    SERIAL_ECHOPAIR("  buffer_segment FR:", fr_mm_s);
+    SERIAL_ECHOPAIR("  _buffer_segment FR:", fr_mm_s);
     #if IS_KINEMATIC
       SERIAL_ECHOPAIR(" A:", a);
       SERIAL_ECHOPAIR(" (", position[A_AXIS]);
@@ -1536,7 +1749,136 @@ void Planner::buffer_segment(const float &a, const float &b, const float &c, con
     //position_float[Z_AXIS] = c;
     position_float[E_AXIS] = e;
   #endif
-} // buffer_segment()
+} // _buffer_segment()
+
+#if ENABLED(SEGMENT_MERGE)
+
+  /**
+   * Planner::buffer_segment
+   *
+   * Merge runs of short, nearly collinear moves into single blocks.
+   *
+   * A short move is held back instead of being queued, as long as the
+   * steppers have other blocks to run. Each move after it is folded in if
+   * every point the held moves pass through stays within
+   * SEGMENT_MERGE_TOLERANCE of the straight line from the start to the new
+   * target, with the same feedrate and extruder and nearly the same E per mm.
+   * The merged block ends exactly at the last target and carries the total E.
+   */
+  void Planner::buffer_segment(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder) {
+    const float target[XYZE] = { a, b, c, e };
+
+    if (merge_count) {
+      if (can_merge(target, fr_mm_s, extruder)) {
+        LOOP_XYZ(i) merge_point[merge_count - 1][i] = merge_end[i];
+        COPY(merge_end, target);
+        merge_count++;
+        return;
+      }
+      flush_merged_segment();
+    }
+
+    // Hold the move back if it's short and the steppers can spare it
+    if (movesplanned() > 1) {
+      #if ENABLED(DISTINCT_E_FACTORS)
+        // Let _buffer_segment deal with an extruder change
+        if (extruder == last_extruder)
+      #endif
+      {
+        LOOP_XYZE(i) merge_start[i] = position[i] * steps_to_mm[i];
+        #if ENABLED(DISTINCT_E_FACTORS)
+          merge_start[E_AXIS] = position[E_AXIS] * steps_to_mm[E_AXIS_N];
+        #endif
+        const float length_sq = sq(a - merge_start[X_AXIS]) + sq(b - merge_start[Y_AXIS]) + sq(c - merge_start[Z_AXIS]);
+        if (WITHIN(length_sq, sq(0.001), sq(SEGMENT_MERGE_MAX_LENGTH))) {
+          COPY(merge_end, target);
+          merge_fr_mm_s = fr_mm_s;
+          merge_e_per_mm = (e - merge_start[E_AXIS]) / SQRT(length_sq);
+          merge_extruder = extruder;
+          merge_count = 1;
+          return;
+        }
+      }
+    }
+
+    _buffer_segment(a, b, c, e, fr_mm_s, extruder);
+  }
+
+  /**
+   * Can the move to target be folded into the held move?
+   */
+  bool Planner::can_merge(const float (&target)[XYZE], const float &fr_mm_s, const uint8_t extruder) {
+    if (merge_count >= SEGMENT_MERGE_MAX_COUNT || fr_mm_s != merge_fr_mm_s || extruder != merge_extruder) return false;
+
+    // The new move must be short, and not E-only
+    const float length_sq = sq(target[X_AXIS] - merge_end[X_AXIS]) + sq(target[Y_AXIS] - merge_end[Y_AXIS]) + sq(target[Z_AXIS] - merge_end[Z_AXIS]);
+    if (!WITHIN(length_sq, sq(0.001), sq(SEGMENT_MERGE_MAX_LENGTH))) return false;
+
+    // Extrusion per mm must stay within 5%
+    const float e_per_mm = (target[E_AXIS] - merge_end[E_AXIS]) / SQRT(length_sq);
+    if (FABS(e_per_mm - merge_e_per_mm) > 0.05 * FABS(merge_e_per_mm)) return false;
+
+    // Every point passed through must lie alongside the merged line,
+    // no farther from it than the tolerance
+    float line[XYZ];
+    LOOP_XYZ(i) line[i] = target[i] - merge_start[i];
+    const float line_sq = sq(line[X_AXIS]) + sq(line[Y_AXIS]) + sq(line[Z_AXIS]);
+    if (line_sq < sq(0.001)) return false;
+    const float inv_line_sq = 1.0 / line_sq;
+
+    for (uint8_t p = 0; p < merge_count; p++) {
+      const float * const point = p < merge_count - 1 ? merge_point[p] : merge_end;
+      float along = 0, dist_sq = 0;
+      LOOP_XYZ(i) {
+        const float v = point[i] - merge_start[i];
+        along += v * line[i];
+        dist_sq += sq(v);
+      }
+      if (!WITHIN(along, 0, line_sq)) return false;
+      if (dist_sq - sq(along) * inv_line_sq > sq(SEGMENT_MERGE_TOLERANCE)) return false;
+    }
+
+    return true;
+  }
+
+  void Planner::flush_merged_segment() {
+    if (!merge_count) return;
+    merge_count = 0;
+    _buffer_segment(merge_end[X_AXIS], merge_end[Y_AXIS], merge_end[Z_AXIS], merge_end[E_AXIS], merge_fr_mm_s, merge_extruder);
+  }
+
+#endif // SEGMENT_MERGE
+
+uint32_t Planner::block_fence() {
+  // The held move is part of the moves queued so far
+  #if ENABLED(SEGMENT_MERGE)
+    flush_merged_segment();
+  #endif
+  return block_sequence;
+}
+
+/**
+ * End a batch: run the deferred look-ahead and make sure the steppers are running
+ */
+void Planner::finish_batch() {
+  defer_recalculate = false;
+  recalculate();
+  stepper.wake_up();
+}
+
+void Planner::buffer_segments(const float (*targets)[XYZE], const uint8_t count, const float &fr_mm_s, const uint8_t extruder) {
+  defer_recalculate = true;
+  for (uint8_t i = 0; i < count; i++)
+    buffer_segment(targets[i][A_AXIS], targets[i][B_AXIS], targets[i][C_AXIS], targets[i][E_AXIS], fr_mm_s, extruder);
+  finish_batch();
+}
+
+void Planner::buffer_lines_kinematic(const float (*cart)[XYZE], const uint8_t count, const float &fr_mm_s, const uint8_t extruder) {
+  defer_recalculate = true;
+  for (uint8_t i = 0; i < count; i++)
+    buffer_line_kinematic(cart[i], fr_mm_s, extruder);
+  finish_batch();
+}
 
 /**
  * Directly set the planner XYZ position (and stepper positions)
@@ -1546,6 +1888,9 @@ void Planner::buffer_segment(const float &a, const float &b, const float &c, con
  */
 
 void Planner::_set_position_mm(const float &a, const float &b, const float &c, const float &e) {
+  #if ENABLED(SEGMENT_MERGE)
+    flush_merged_segment();
+  #endif
   #if ENABLED(DISTINCT_E_FACTORS)
     #define _EINDEX (E_AXIS + active_extruder)
     last_extruder = active_extruder;
@@ -1586,6 +1931,9 @@ void Planner::set_position_mm_kinematic(const float (&cart)[XYZE]) {
  * Sync from the stepper positions. (e.g., after an interrupted move)
  */
 void Planner::sync_from_steppers() {
+  #if ENABLED(SEGMENT_MERGE)
+    discard_merged_segment();
+  #endif
   LOOP_XYZE(i) {
     position[i] = stepper.position((AxisEnum)i);
     #if ENABLED(LIN_ADVANCE)
@@ -1598,10 +1946,128 @@ void Planner::sync_from_steppers() {
   }
 }
 
+#if ENABLED(BLOCK_SYNC_EVENTS)
+
+  /**
+   * Get the next free event slot, waiting for one if needed.
+   * Events are freed as their moves start.
+   */
+  sync_event_t& Planner::next_sync_event() {
+    // The event follows the held move
+    #if ENABLED(SEGMENT_MERGE)
+      flush_merged_segment();
+    #endif
+
+    while (SYNC_EVENT_MOD(sync_event_head + 1) == sync_event_tail) {
+      idle();
+      apply_sync_events();
+    }
+    return sync_event_buffer[sync_event_head];
+  }
+
+  /**
+   * Queue the event filled in at next_sync_event()
+   */
+  void Planner::commit_sync_event() {
+    sync_event_head = SYNC_EVENT_MOD(sync_event_head + 1);
+    sync_events_pending++;
+
+    // With nothing queued there's nothing to wait for
+    if (!blocks_queued()) apply_sync_events();
+  }
+
+  /**
+   * The pins M42 refuses to change: serial, steppers, endstops, heaters, sensors
+   */
+  static bool sync_pin_is_protected(const uint8_t pin) {
+    static const int8_t sensitive_pins[] PROGMEM = SENSITIVE_PINS;
+    for (uint8_t i = 0; i < COUNT(sensitive_pins); i++)
+      if ((int8_t)pin == (int8_t)pgm_read_byte(&sensitive_pins[i])) return true;
+    return false;
+  }
+
+  bool Planner::add_sync_event(const SyncEventType type, const uint8_t index, const int16_t value) {
+    if ((type == SYNC_EVENT_PIN || type == SYNC_EVENT_PWM) && sync_pin_is_protected(index)) return false;
+    sync_event_t &event = next_sync_event();
+    event.type = type;
+    event.index = index;
+    event.value = value;
+    commit_sync_event();
+    return true;
+  }
+
+  #if HAS_COLOR_LEDS
+
+    void Planner::add_sync_led_event(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t w/*=0*/) {
+      sync_event_t &event = next_sync_event();
+      event.type = SYNC_EVENT_LED;
+      event.rgbw[0] = r;
+      event.rgbw[1] = g;
+      event.rgbw[2] = b;
+      event.rgbw[3] = w;
+      commit_sync_event();
+    }
+
+  #endif
+
+  static void apply_sync_event(const sync_event_t &event) {
+    switch (event.type) {
+      case SYNC_EVENT_HOTEND_TEMP:
+        thermalManager.setTargetHotend(event.value, event.index);
+        break;
+      case SYNC_EVENT_BED_TEMP:
+        thermalManager.setTargetBed(event.value);
+        break;
+      case SYNC_EVENT_PIN:
+        pinMode(event.index, OUTPUT);
+        digitalWrite(event.index, event.value ? HIGH : LOW);
+        break;
+      case SYNC_EVENT_PWM:
+        pinMode(event.index, OUTPUT);
+        analogWrite(event.index, event.value);
+        break;
+      case SYNC_EVENT_LED:
+        #if HAS_COLOR_LEDS
+          leds.set_color(MakeLEDColor(event.rgbw[0], event.rgbw[1], event.rgbw[2], event.rgbw[3], NEOPIXEL_BRIGHTNESS));
+        #endif
+        break;
+    }
+  }
+
+  void Planner::apply_sync_events() {
+    uint8_t due;
+    CRITICAL_SECTION_START
+      // Once the moves are done the events after them are due too
+      if (!blocks_queued()) {
+        sync_events_due += sync_events_pending;
+        sync_events_pending = 0;
+      }
+      due = sync_events_due;
+      sync_events_due = 0;
+    CRITICAL_SECTION_END
+
+    for (; due; due--) {
+      apply_sync_event(sync_event_buffer[sync_event_tail]);
+      sync_event_tail = SYNC_EVENT_MOD(sync_event_tail + 1);
+    }
+  }
+
+  void Planner::discard_sync_events() {
+    CRITICAL_SECTION_START
+      sync_event_tail = sync_event_head;
+      sync_events_pending = sync_events_due = 0;
+    CRITICAL_SECTION_END
+  }
+
+#endif // BLOCK_SYNC_EVENTS
+
 /**
  * Setters for planner position (also setting stepper position).
  */
 void Planner::set_position_mm(const AxisEnum axis, const float &v) {
+  #if ENABLED(SEGMENT_MERGE)
+    flush_merged_segment();
+  #endif
   #if ENABLED(DISTINCT_E_FACTORS)
     const uint8_t axis_index = axis + (axis == E_AXIS ? active_extruder : 0);
     last_extruder = active_extruder;
@@ -1616,6 +2082,34 @@ void Planner::set_position_mm(const AxisEnum axis, const float &v) {
   previous_speed[axis] = 0.0;
 }
 
+void Planner::shift_position_mm(const AxisEnum axis, const float &distance) {
+  // The held move comes before the shift
+  #if ENABLED(SEGMENT_MERGE)
+    flush_merged_segment();
+  #endif
+
+  #if ENABLED(DELTA)
+    const uint8_t first = axis == Z_AXIS ? A_AXIS : axis, last = axis == Z_AXIS ? C_AXIS : axis;
+  #else
+    const uint8_t first = axis, last = axis;
+  #endif
+
+  for (uint8_t i = first; i <= last; i++) {
+    #if ENABLED(DISTINCT_E_FACTORS)
+      const uint8_t axis_index = i + (i == E_AXIS ? active_extruder : 0);
+      if (i == E_AXIS) last_extruder = active_extruder;
+    #else
+      const uint8_t axis_index = i;
+    #endif
+    const int32_t steps = LROUND(distance * axis_steps_per_mm[axis_index]);
+    position[i] += steps;
+    #if ENABLED(LIN_ADVANCE)
+      position_float[i] += distance;
+    #endif
+    stepper.shift_position((AxisEnum)i, steps);
+  }
+}
+
 // Recalculate the steps/s^2 acceleration rates, based on the mm/s^2
 void Planner::reset_acceleration_rates() {
   #if ENABLED(DISTINCT_E_FACTORS)
@@ -1631,13 +2125,45 @@ void Planner::reset_acceleration_rates() {
   cutoff_long = 4294967295UL / highest_rate;
 }
 
+/**
+ * M931: Report the queued blocks and their estimated run time
+ */
+void Planner::report_buffer() {
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPAIR("Planner blocks:", movesplanned());
+  SERIAL_ECHOPAIR(" time:", (unsigned long)(buffered_time_us() / 1000));
+  #if ENABLED(SLOWDOWN)
+    SERIAL_ECHOPAIR("ms slowdown below:", (unsigned long)((SLOWDOWN_BUFFER_US) / 1000));
+  #endif
+  SERIAL_ECHOLNPGM("ms");
+}
+
 // Recalculate position, steps_to_mm if axis_steps_per_mm changes!
 void Planner::refresh_positioning() {
   LOOP_XYZE_N(i) steps_to_mm[i] = 1.0 / axis_steps_per_mm[i];
   set_position_mm_kinematic(current_position);
   reset_acceleration_rates();
+  #if ENABLED(PID_FIXED_POINT) && ENABLED(PID_EXTRUSION_SCALING)
+    thermalManager.updatePID(); // Kc is kept per E step
+  #endif
 }
 
+#if ENABLED(JUNCTION_DEVIATION)
+
+  void Planner::junction_deviation_M205() {
+    if (parser.seen('J')) {
+      const float junc_dev = parser.value_linear_units();
+      if (WITHIN(junc_dev, 0.01, 0.3))
+        junction_deviation_mm = junc_dev;
+      else {
+        SERIAL_ERROR_START();
+        SERIAL_ERRORLNPGM("?J out of range (0.01 to 0.3)");
+      }
+    }
+  }
+
+#endif
+
 #if ENABLED(AUTOTEMP)
 
   void Planner::autotemp_M104_M109() {
@@ -56,7 +56,10 @@ enum BlockFlagBit {
   BLOCK_BIT_BUSY,
 
   // The block is segment 2+ of a longer move
-  BLOCK_BIT_CONTINUED
+  BLOCK_BIT_CONTINUED,
+
+  // The block uses LIN_ADVANCE extruder pressure control
+  BLOCK_BIT_USE_ADVANCE_LEAD
 };
 
 enum BlockFlag {
@@ -64,9 +67,36 @@ enum BlockFlag {
   BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH),
   BLOCK_FLAG_START_FROM_FULL_HALT = _BV(BLOCK_BIT_START_FROM_FULL_HALT),
   BLOCK_FLAG_BUSY                 = _BV(BLOCK_BIT_BUSY),
-  BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED)
+  BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED),
+  BLOCK_FLAG_USE_ADVANCE_LEAD     = _BV(BLOCK_BIT_USE_ADVANCE_LEAD)
 };
 
+#if ENABLED(BLOCK_SYNC_EVENTS)
+
+  enum SyncEventType : char {
+    SYNC_EVENT_HOTEND_TEMP,   // Set hotend 'index' target to 'value' °C
+    SYNC_EVENT_BED_TEMP,      // Set the bed target to 'value' °C
+    SYNC_EVENT_PIN,           // Set pin 'index' LOW (value 0) or HIGH, as M42
+    SYNC_EVENT_PWM,           // Set the hardware PWM of pin 'index' to 'value' (0-255)
+    SYNC_EVENT_LED            // Set the LEDs to 'rgbw'
+  };
+
+  /**
+   * A state change made when the move queued after it starts
+   */
+  typedef struct {
+    SyncEventType type;
+    uint8_t index;
+    union {
+      int16_t value;
+      uint8_t rgbw[4];
+    };
+  } sync_event_t;
+
+  #define SYNC_EVENT_MOD(n) ((n)&(BLOCK_SYNC_EVENT_BUFFER_SIZE-1))
+
+#endif
+
 /**
  * struct block_t
  *
@@ -75,12 +105,25 @@ enum BlockFlag {
  *
  * The "nominal" values are as-specified by gcode, and
  * may never actually be reached due to acceleration limits.
+ *
+ * The fields read by the Stepper ISR come first, followed by those
+ * only used by the planner.
  */
 typedef struct {
 
-  uint8_t flag;                             // Block flags (See BlockFlag enum above)
+  //
+  // Fields used by the Stepper ISR
+  //
 
-  unsigned char active_extruder;            // The extruder to move (if E move)
+  uint8_t flag,                             // Block flags (See BlockFlag enum above)
+          direction_bits,                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+          active_extruder;                  // The extruder to move (if E move)
+
+  uint8_t initial_step_loops : 4,           // Steps per ISR at the initial rate (1, 2, 4 or 8)
+          nominal_step_loops : 4;           // Steps per ISR at the nominal rate
+
+  uint16_t initial_timer,                   // Timer interval for the initial rate, precomputed for the ISR
+           nominal_timer;                   // Timer interval for the nominal rate
 
   // Fields used by the Bresenham algorithm for tracing the line
   int32_t steps[NUM_AXIS];                  // Step count along each axis
@@ -94,37 +137,50 @@ typedef struct {
           decelerate_after,                 // The index of the step event on which to start decelerating
           acceleration_rate;                // The acceleration rate used for acceleration calculation
 
-  uint8_t direction_bits;                   // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
+  // Settings for the trapezoid generator
+  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
+           initial_rate,                    // The jerk-adjusted step rate at start of block
+           final_rate;                      // The minimal rate at exit
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint32_t cruise_rate,                   // The actual cruise rate, reached at the end of the acceleration phase
+             acceleration_time,             // Duration of the acceleration phase in stepper timer ticks
+             deceleration_time,             // Duration of the deceleration phase in stepper timer ticks
+             acceleration_time_inverse,     // 0xFFFFFFFF / acceleration_time, so the ISR can normalize time without a divide
+             deceleration_time_inverse;     // 0xFFFFFFFF / deceleration_time
+  #endif
 
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
-    bool use_advance_lead;
-    uint32_t abs_adv_steps_multiplier8; // Factorised by 2^8 to avoid float
+    uint16_t advance_speed,                 // Timer interval between pressure steps while the speed changes
+             max_adv_steps,                 // Pressure (in E steps) at the nominal speed
+             final_adv_steps;               // Pressure (in E steps) at the exit speed
   #endif
 
+  //
+  // Fields used only by the planner
+  //
+
   // Fields used by the motion planner to manage acceleration
   float nominal_speed,                      // The nominal speed for this block in mm/sec
         entry_speed,                        // Entry speed at previous-current junction in mm/sec
         max_entry_speed,                    // Maximum allowable junction entry speed in mm/sec
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
+        max_speed_sqr_change;               // 2 * acceleration * millimeters: the most (mm/sec)^2 the speed can change over the block
 
-  // Settings for the trapezoid generator
-  uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
-           initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+  uint32_t segment_time_us;                 // Estimated duration, for the slowdown and the LCD's remaining time
 
   #if FAN_COUNT > 0
-    uint16_t fan_speed[FAN_COUNT];
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BLOCK_SYNC_EVENTS)
+    uint8_t sync_events;                    // Number of sync events due when the block starts
   #endif
 
   #if ENABLED(BARICUDA)
     uint8_t valve_pressure, e_to_p_pressure;
   #endif
 
-  uint32_t segment_time_us;
-
 } block_t;
 
 #define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
@@ -144,10 +200,15 @@ class Planner {
      *
      *  Writer of head is Planner::buffer_segment().
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
+     *
+     *  Blocks from tail up to (not including) planned are optimally planned
+     *  and are never revisited by recalculate(). The ISR pushes planned ahead
+     *  of any block it takes, so it always stays between tail+1 and head.
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
     static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
-                            block_buffer_tail;      // Index of the busy block, if any
+                            block_buffer_tail,      // Index of the busy block, if any
+                            block_buffer_planned;   // Index of the first block that may still be re-planned
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -178,6 +239,10 @@ class Planner {
                  max_jerk[XYZE],       // The largest speed change requiring no acceleration
                  min_travel_feedrate_mm_s;
 
+    #if ENABLED(JUNCTION_DEVIATION)
+      static float junction_deviation_mm;   // Use 'M205 J<mm>' to override
+    #endif
+
     #if HAS_LEVELING
       static bool leveling_active;          // Flag that bed leveling is enabled
       #if ABL_PLANAR
@@ -231,11 +296,78 @@ class Planner {
      */
     static float previous_nominal_speed;
 
+    #if ENABLED(JUNCTION_DEVIATION)
+      /**
+       * Unit vector of previous path line segment
+       */
+      static float previous_unit_vec[XYZ];
+    #endif
+
     /**
      * Limit where 64bit math is necessary for acceleration calculation
      */
     static uint32_t cutoff_long;
 
+    /**
+     * Set while a batch of segments is queued. The look-ahead then
+     * runs once at the end instead of after every segment.
+     */
+    static bool defer_recalculate;
+
+    /**
+     * The sequence number of the last block queued, and of the last block
+     * the Stepper ISR finished or discarded
+     */
+    static uint32_t block_sequence;
+    static volatile uint32_t block_sequence_done;
+
+    /**
+     * The number of queued blocks that move each axis. Counted up as blocks
+     * are queued and down as the Stepper ISR discards them.
+     */
+    static volatile uint8_t axis_active_blocks[NUM_AXIS];
+
+    #if ENABLED(AUTOTEMP)
+      /**
+       * Queued blocks that move the extruder faster than every block queued
+       * after them, oldest first, with their E speeds (mm/s). The front is
+       * the fastest block in the buffer. Blocks discarded by the ISR are
+       * dropped from the front when the list is next used.
+       */
+      static uint8_t autotemp_block[BLOCK_BUFFER_SIZE],
+                     autotemp_front, autotemp_back;
+      static float autotemp_speed[BLOCK_BUFFER_SIZE];
+      static void autotemp_prune();
+      static void autotemp_push(const uint8_t block_index, const float &e_speed);
+    #endif
+
+    #if ENABLED(SEGMENT_MERGE)
+      /**
+       * The move held back for merging: where it starts and ends, the ends
+       * of the moves already merged into it, and what they must share with
+       * any move merged next. merge_count is 0 when no move is held.
+       */
+      static float merge_start[XYZE], merge_end[XYZE],
+                   merge_point[SEGMENT_MERGE_MAX_COUNT - 1][XYZ],
+                   merge_fr_mm_s, merge_e_per_mm;
+      static uint8_t merge_count, merge_extruder;
+      static bool can_merge(const float (&target)[XYZE], const float &fr_mm_s, const uint8_t extruder);
+    #endif
+
+    #if ENABLED(BLOCK_SYNC_EVENTS)
+      /**
+       * Queued state changes, oldest first. The oldest sync_events_due belong
+       * to blocks that have started and are waiting to be applied. The newest
+       * sync_events_pending were added after the last queued block and go to
+       * the next block.
+       */
+      static sync_event_t sync_event_buffer[BLOCK_SYNC_EVENT_BUFFER_SIZE];
+      static uint8_t sync_event_head, sync_event_tail, sync_events_pending;
+      static volatile uint8_t sync_events_due;
+      static sync_event_t& next_sync_event();
+      static void commit_sync_event();
+    #endif
+
     #if ENABLED(ENABLE_LEVELING_FADE_HEIGHT)
       static float last_fade_z;
     #endif
@@ -256,9 +388,7 @@ class Planner {
       static uint32_t axis_segment_time_us[2][3];
     #endif
 
-    #if ENABLED(ULTRA_LCD)
-      volatile static uint32_t block_buffer_runtime_us; //Theoretical block buffer runtime in µs
-    #endif
+    volatile static uint32_t block_buffer_runtime_us; //Theoretical block buffer runtime in µs
 
   public:
 
@@ -415,10 +545,25 @@ class Planner {
      */
     static void _buffer_steps(const int32_t (&target)[XYZE], float fr_mm_s, const uint8_t extruder);
 
+    /**
+     * Planner::_buffer_segment
+     *
+     * Add a new linear movement to the buffer in axis units.
+     *
+     * Leveling and kinematics should be applied ahead of calling this.
+     *
+     *  a,b,c,e   - target positions in mm and/or degrees
+     *  fr_mm_s   - (target) speed of the move
+     *  extruder  - target extruder
+     */
+    static void _buffer_segment(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder);
+
     /**
      * Planner::buffer_segment
      *
      * Add a new linear movement to the buffer in axis units.
+     * With SEGMENT_MERGE short moves may be held back and merged
+     * with the moves that follow them.
      *
      * Leveling and kinematics should be applied ahead of calling this.
      *
@@ -426,10 +571,61 @@ class Planner {
      *  fr_mm_s   - (target) speed of the move
      *  extruder  - target extruder
      */
-    static void buffer_segment(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder);
+    #if ENABLED(SEGMENT_MERGE)
+      static void buffer_segment(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder);
+
+      /**
+       * Queue the move held back for merging, if any. Called before anything
+       * waits on the planner and when the steppers are about to run dry.
+       */
+      static void flush_merged_segment();
+
+      /**
+       * Forget the held move without queueing it. (e.g., on quick_stop)
+       */
+      FORCE_INLINE static void discard_merged_segment() { merge_count = 0; }
+    #else
+      FORCE_INLINE static void buffer_segment(const float &a, const float &b, const float &c, const float &e, const float &fr_mm_s, const uint8_t extruder) {
+        _buffer_segment(a, b, c, e, fr_mm_s, extruder);
+      }
+    #endif
+
+    /**
+     * Planner::buffer_segments
+     *
+     * Add several linear movements to the buffer in axis units, all at the
+     * same feedrate. The look-ahead runs once for the whole batch, or early
+     * if the buffer fills up, so the steppers always have a plan to run.
+     *
+     * Leveling and kinematics should be applied ahead of calling this.
+     *
+     *  targets   - count target positions in mm and/or degrees
+     *  count     - number of segments
+     *  fr_mm_s   - (target) speed of the moves
+     *  extruder  - target extruder
+     */
+    static void buffer_segments(const float (*targets)[XYZE], const uint8_t count, const float &fr_mm_s, const uint8_t extruder);
 
     static void _set_position_mm(const float &a, const float &b, const float &c, const float &e);
 
+    /**
+     * A fence for the moves queued so far: the sequence number of the last
+     * queued block. Stepper::wait_for_block() with it waits for those moves
+     * only, while later moves may already be queued.
+     */
+    static uint32_t block_fence();
+
+    /**
+     * Is the block with this sequence number finished (or discarded)?
+     * Wraparound-safe for fences up to 2^31 blocks old.
+     */
+    static bool block_done(const uint32_t sequence) {
+      CRITICAL_SECTION_START
+        const uint32_t done = block_sequence_done;
+      CRITICAL_SECTION_END
+      return (int32_t)(done - sequence) >= 0;
+    }
+
     /**
      * Add a new linear movement to the buffer.
      * The target is NOT translated to delta/scara
@@ -473,6 +669,18 @@ class Planner {
       #endif
     }
 
+    /**
+     * Add several linear movements to the buffer, as buffer_segments.
+     * The targets are cartesian and are leveled and translated to
+     * delta/scara as with buffer_line_kinematic.
+     *
+     *  cart     - count x,y,z,e CARTESIAN targets in mm
+     *  count    - number of segments
+     *  fr_mm_s  - (target) speed of the moves (mm/s)
+     *  extruder - target extruder
+     */
+    static void buffer_lines_kinematic(const float (*cart)[XYZE], const uint8_t count, const float &fr_mm_s, const uint8_t extruder);
+
     /**
      * Set the planner.position and individual stepper positions.
      * Used by G92, G28, G29, and other procedures.
@@ -493,11 +701,44 @@ class Planner {
     FORCE_INLINE static void set_z_position_mm(const float &z) { set_position_mm(Z_AXIS, z); }
     FORCE_INLINE static void set_e_position_mm(const float &e) { set_position_mm(AxisEnum(E_AXIS), e); }
 
+    /**
+     * Shift the planner and stepper positions of one axis by a distance,
+     * without waiting for the queued moves. The stepper counts move by the
+     * same number of steps, so they agree with the planner once the queued
+     * moves are done. The junction with the last move is kept.
+     * On DELTA a Z shift moves all the towers.
+     */
+    static void shift_position_mm(const AxisEnum axis, const float &distance);
+
     /**
      * Sync from the stepper positions. (e.g., after an interrupted move)
      */
     static void sync_from_steppers();
 
+    #if ENABLED(BLOCK_SYNC_EVENTS)
+      /**
+       * Make a state change when the next queued move starts, or when the
+       * queued moves are done if no move follows, instead of waiting for the
+       * moves with synchronize(). Applied right away if no moves are queued.
+       * Pin events for the pins M42 protects are refused, returning false.
+       */
+      static bool add_sync_event(const SyncEventType type, const uint8_t index, const int16_t value);
+      #if HAS_COLOR_LEDS
+        static void add_sync_led_event(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t w=0);
+      #endif
+
+      /**
+       * Apply the state changes of the moves that have started.
+       * Called from the main loop, like the fan speed updates.
+       */
+      static void apply_sync_events();
+
+      /**
+       * Drop all queued state changes. (e.g., on quick_stop)
+       */
+      static void discard_sync_events();
+    #endif
+
     /**
      * Does the buffer have any blocks queued?
      */
@@ -508,8 +749,21 @@ class Planner {
      * Called when the current block is no longer needed.
      */
     FORCE_INLINE static void discard_current_block() {
-      if (blocks_queued())
+      if (blocks_queued()) {
+        const uint8_t discarded = block_buffer_tail;
+        const block_t * const block = &block_buffer[discarded];
+        LOOP_XYZE(i) if (block->steps[i]) axis_active_blocks[i]--;
+        // A block dropped before it started still counts in the buffered time
+        if (!TEST(block->flag, BLOCK_BIT_BUSY)) block_buffer_runtime_us -= block->segment_time_us;
+        #if ENABLED(BLOCK_SYNC_EVENTS)
+          // A block dropped before it started still owns its events. They're due now.
+          sync_events_due += block->sync_events;
+        #endif
+        block_sequence_done++;              // Blocks are always discarded in queue order
         block_buffer_tail = BLOCK_MOD(block_buffer_tail + 1);
+        // Never let the planned pointer fall behind the tail
+        if (block_buffer_planned == discarded) block_buffer_planned = block_buffer_tail;
+      }
     }
 
     /**
@@ -540,42 +794,56 @@ class Planner {
         else if (TEST(block->flag, BLOCK_BIT_RECALCULATE))
           return NULL;
 
-        #if ENABLED(ULTRA_LCD)
-          block_buffer_runtime_us -= block->segment_time_us; // We can't be sure how long an active block will take, so don't count it.
+        block_buffer_runtime_us -= block->segment_time_us; // We can't be sure how long an active block will take, so don't count it.
+        #if ENABLED(BLOCK_SYNC_EVENTS)
+          // The block's state changes are due now
+          sync_events_due += block->sync_events;
+          block->sync_events = 0;
         #endif
         SBI(block->flag, BLOCK_BIT_BUSY);
+        // The busy block's exit speed is now fixed, so planning must start past it
+        if (block_buffer_planned == block_buffer_tail)
+          block_buffer_planned = next_block_index(block_buffer_tail);
         return block;
       }
       else {
-        #if ENABLED(ULTRA_LCD)
-          clear_block_buffer_runtime(); // paranoia. Buffer is empty now - so reset accumulated time to zero.
-        #endif
+        clear_block_buffer_runtime(); // paranoia. Buffer is empty now - so reset accumulated time to zero.
         return NULL;
       }
     }
 
-    #if ENABLED(ULTRA_LCD)
-
-      static uint16_t block_buffer_runtime() {
-        CRITICAL_SECTION_START
-          millis_t bbru = block_buffer_runtime_us;
-        CRITICAL_SECTION_END
-        // To translate µs to ms a division by 1000 would be required.
-        // We introduce 2.4% error here by dividing by 1024.
-        // Doesn't matter because block_buffer_runtime_us is already too small an estimation.
-        bbru >>= 10;
-        // limit to about a minute.
-        NOMORE(bbru, 0xFFFFul);
-        return bbru;
-      }
+    /**
+     * The estimated run time of the queued blocks in µs,
+     * not counting the block in progress
+     */
+    static uint32_t buffered_time_us() {
+      CRITICAL_SECTION_START
+        const uint32_t bbru = block_buffer_runtime_us;
+      CRITICAL_SECTION_END
+      return bbru;
+    }
 
-      static void clear_block_buffer_runtime(){
-        CRITICAL_SECTION_START
-          block_buffer_runtime_us = 0;
-        CRITICAL_SECTION_END
-      }
+    static uint16_t block_buffer_runtime() {
+      millis_t bbru = buffered_time_us();
+      // To translate µs to ms a division by 1000 would be required.
+      // We introduce 2.4% error here by dividing by 1024.
+      // Doesn't matter because block_buffer_runtime_us is already too small an estimation.
+      bbru >>= 10;
+      // limit to about a minute.
+      NOMORE(bbru, 0xFFFFul);
+      return bbru;
+    }
 
-    #endif
+    static void clear_block_buffer_runtime(){
+      CRITICAL_SECTION_START
+        block_buffer_runtime_us = 0;
+      CRITICAL_SECTION_END
+    }
+
+    /**
+     * Report the queued blocks and their estimated run time (M931)
+     */
+    static void report_buffer();
 
     #if ENABLED(AUTOTEMP)
       static float autotemp_min, autotemp_max, autotemp_factor;
@@ -584,6 +852,10 @@ class Planner {
       static void autotemp_M104_M109();
     #endif
 
+    #if ENABLED(JUNCTION_DEVIATION)
+      static void junction_deviation_M205();
+    #endif
+
   private:
 
     /**
@@ -592,6 +864,12 @@ class Planner {
     static constexpr int8_t next_block_index(const int8_t block_index) { return BLOCK_MOD(block_index + 1); }
     static constexpr int8_t prev_block_index(const int8_t block_index) { return BLOCK_MOD(block_index - 1); }
 
+    //
+    // The trapezoid math below stays in float. On AVR a 32-bit integer divide
+    // costs more than a float divide, the squared step rates overflow 32 bits
+    // above 46340 steps/s, and the SQRT would need its own integer version.
+    //
+
     /**
      * Calculate the distance (not time) it takes to accelerate
      * from initial_rate to target_rate using the given acceleration:
@@ -615,26 +893,46 @@ class Planner {
     }
 
     /**
-     * Calculate the maximum allowable speed at this point, in order
-     * to reach 'target_velocity' using 'acceleration' within a given
-     * 'distance'.
+     * Calculate the maximum allowable speed at the start of a block, in order
+     * to slow down to 'target_velocity' by its end. 'speed_sqr_change' is the
+     * block's max_speed_sqr_change, 2 * acceleration * distance.
      */
-    static float max_allowable_speed(const float &accel, const float &target_velocity, const float &distance) {
-      return SQRT(sq(target_velocity) - 2 * accel * distance);
+    static float max_allowable_speed(const float &speed_sqr_change, const float &target_velocity) {
+      return SQRT(sq(target_velocity) + speed_sqr_change);
     }
 
+    #if ENABLED(S_CURVE_ACCELERATION)
+      /**
+       * Calculate the speed reached after accelerating at 'accel'
+       * from 'initial_velocity' over the given 'distance'.
+       */
+      static float final_speed(const float &initial_velocity, const float &accel, const float &distance) {
+        return SQRT(sq(initial_velocity) + 2 * accel * distance);
+      }
+
+      /**
+       * Return 0xFFFFFFFF / period, used by the stepper ISR to
+       * normalize the elapsed time of an S-curve phase.
+       */
+      FORCE_INLINE static uint32_t get_period_inverse(const uint32_t period) {
+        return period ? 0xFFFFFFFFUL / period : 0xFFFFFFFFUL;
+      }
+    #endif
+
     static void calculate_trapezoid_for_block(block_t* const block, const float &entry_factor, const float &exit_factor);
 
     static void reverse_pass_kernel(block_t* const current, const block_t * const next);
-    static void forward_pass_kernel(const block_t * const previous, block_t* const current);
+    static void forward_pass_kernel(const block_t * const previous, block_t* const current, const uint8_t block_index);
 
     static void reverse_pass();
     static void forward_pass();
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const uint8_t first_block_index);
 
     static void recalculate();
 
+    static void finish_batch();
+
 };
 
 #define PLANNER_XY_FEEDRATE() (min(planner.max_feedrate_mm_s[X_AXIS], planner.max_feedrate_mm_s[Y_AXIS]))
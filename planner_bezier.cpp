@@ -40,6 +40,9 @@
 #define MAX_STEP 0.1
 #define SIGMA 0.1
 
+// Segments handed to the planner at once, so the look-ahead runs once per batch
+#define BATCH_SEGMENTS 8
+
 /* Compute the linear interpolation between to real numbers.
 */
 inline static float interp(float a, float b, float t) { return (1.0 - t) * a + t * b; }
@@ -118,6 +121,9 @@ void cubic_b_spline(const float position[NUM_AXIS], const float target[NUM_AXIS]
   bez_target[Y_AXIS] = position[Y_AXIS];
   float step = MAX_STEP;
 
+  float batch[BATCH_SEGMENTS][XYZE];
+  uint8_t batched = 0;
+
   millis_t next_idle_ms = millis() + 200UL;
 
   while (t < 1.0) {
@@ -187,7 +193,11 @@ void cubic_b_spline(const float position[NUM_AXIS], const float target[NUM_AXIS]
     bez_target[Z_AXIS] = interp(position[Z_AXIS], target[Z_AXIS], t);
     bez_target[E_AXIS] = interp(position[E_AXIS], target[E_AXIS], t);
     clamp_to_software_endstops(bez_target);
-    planner.buffer_line_kinematic(bez_target, fr_mm_s, extruder);
+    COPY(batch[batched], bez_target);
+    if (++batched == BATCH_SEGMENTS || t >= 1.0) {
+      planner.buffer_lines_kinematic(batch, batched, fr_mm_s, extruder);
+      batched = 0;
+    }
   }
 }
 
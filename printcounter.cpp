@@ -93,7 +93,7 @@ void PrintCounter::saveStats() {
 }
 
 void PrintCounter::showStats() {
-  char buffer[21];
+  char buffer[22];
   duration_t elapsed;
 
   SERIAL_PROTOCOLPGM(MSG_STATS);
@@ -54,6 +54,14 @@
 #include "cardreader.h"
 #include "speed_lookuptable.h"
 
+#if ENABLED(ISR_STATISTICS)
+  #include "isr_stats.h"
+#endif
+
+#if ENABLED(INPUT_SHAPING)
+  #include "gcode.h"
+#endif
+
 #if ENABLED(AUTO_BED_LEVELING_UBL) && ENABLED(ULTIPANEL)
   #include "ubl.h"
 #endif
@@ -102,38 +110,66 @@ long Stepper::counter_X = 0,
 
 volatile uint32_t Stepper::step_events_completed = 0; // The number of step events executed in the current block
 
-#if ENABLED(LIN_ADVANCE)
+#if HAS_STEP_ISR_SCHEDULER
+  constexpr uint16_t ISR_NEVER = 65535;
+  uint16_t Stepper::nextMainISR = 0;
+#endif
 
-  constexpr uint16_t ADV_NEVER = 65535;
+#if ENABLED(LIN_ADVANCE)
 
-  uint16_t Stepper::nextMainISR = 0,
-           Stepper::nextAdvanceISR = ADV_NEVER,
-           Stepper::eISR_Rate = ADV_NEVER;
+  uint16_t Stepper::nextAdvanceISR = ISR_NEVER;
 
   volatile int Stepper::e_steps[E_STEPPERS];
-  int Stepper::final_estep_rate,
-      Stepper::current_estep_rate[E_STEPPERS],
-      Stepper::current_adv_steps[E_STEPPERS];
+  int Stepper::current_adv_steps[E_STEPPERS];
 
-  /**
-   * See https://github.com/MarlinFirmware/Marlin/issues/5699#issuecomment-309264382
-   *
-   * This fix isn't perfect and may lose steps - but better than locking up completely
-   * in future the planner should slow down if advance stepping rate would be too high
-   */
-  FORCE_INLINE uint16_t adv_rate(const int steps, const uint16_t timer, const uint8_t loops) {
-    if (steps) {
-      const uint16_t rate = (timer * loops) / abs(steps);
-      //return constrain(rate, 1, ADV_NEVER - 1)
-      return rate ? rate : 1;
-    }
-    return ADV_NEVER;
-  }
+  uint8_t Stepper::LA_active_extruder = 0;
+  uint16_t Stepper::LA_advance_speed,
+           Stepper::LA_max_adv_steps = 0,
+           Stepper::LA_final_adv_steps = 0;
+  bool Stepper::LA_decelerating = false;
 
 #endif // LIN_ADVANCE
 
+#if ENABLED(INPUT_SHAPING)
+  float Stepper::shaping_frequency[2],
+        Stepper::shaping_zeta[2];
+  uint32_t Stepper::shaping_max_rate = UINT32_MAX;
+
+  uint16_t Stepper::nextShapingISR = ISR_NEVER;
+  uint32_t Stepper::shaping_clock = 0;
+  uint16_t Stepper::shaping_min_interval = 0;
+  uint8_t Stepper::shaping_axes = 0;
+  int16_t Stepper::shaping_amplitude[2][SHAPING_IMPULSES];
+  uint32_t Stepper::shaping_delay[2][SHAPING_IMPULSES];
+  Stepper::shaping_event_t Stepper::shaping_queue[SHAPING_BUFFER_SIZE];
+  volatile uint8_t Stepper::shaping_head = 0,
+                   Stepper::shaping_echo[2][SHAPING_IMPULSES - 1] = { { 0 } };
+  int8_t Stepper::shaping_steps[2] = { 0 };
+  int16_t Stepper::shaping_sum[2] = { 0 };
+  volatile int16_t Stepper::shaping_pending[2] = { 0 };
+  int8_t Stepper::shaping_dir[2] = { 0 };
+#endif
+
 long Stepper::acceleration_time, Stepper::deceleration_time;
 
+#if ENABLED(STEP_SEGMENT_BUFFER)
+  Stepper::step_segment_t Stepper::segment_buffer[STEP_SEGMENT_BUFFER_SIZE];
+  volatile uint8_t Stepper::segment_buffer_head = 0,
+                   Stepper::segment_buffer_tail = 0,
+                   Stepper::segment_sync = 0;
+  uint8_t Stepper::prep_sync = 0;
+  uint32_t Stepper::prep_step_events;
+  long Stepper::prep_acceleration_time, Stepper::prep_deceleration_time;
+  uint16_t Stepper::prep_acc_step_rate;
+  uint8_t Stepper::prep_step_loops;
+#endif
+
+#if ENABLED(S_CURVE_ACCELERATION)
+  int32_t Stepper::bezier_F, Stepper::bezier_D;
+  uint32_t Stepper::bezier_AV;
+  bool Stepper::bezier_2nd_half;
+#endif
+
 volatile long Stepper::count_position[NUM_AXIS] = { 0 };
 volatile signed char Stepper::count_direction[NUM_AXIS] = { 1, 1, 1, 1 };
 
@@ -143,6 +179,11 @@ volatile signed char Stepper::count_direction[NUM_AXIS] = { 1, 1, 1, 1 };
 
 uint8_t Stepper::step_loops, Stepper::step_loops_nominal;
 
+#if MULTISTEPPING_LIMIT > 1 && !defined(MULTISTEP_ISR_TICKS)
+  // Until measured, assume the ISR may run at 10kHz
+  uint8_t Stepper::isr_ticks = min((STEPPER_TIMER_RATE) / ((MULTISTEP_ISR_HEADROOM) * 10000UL), 255UL);
+#endif
+
 uint16_t Stepper::OCR1A_nominal,
          Stepper::acc_step_rate; // needed for deceleration start point
 
@@ -229,6 +270,83 @@ volatile long Stepper::endstops_trigsteps[XYZ];
   #define E_APPLY_STEP(v,Q) E_STEP_WRITE(v)
 #endif
 
+/**
+ * Port-grouped step pulses
+ *
+ * An axis driven by one stepper through a plain pin write may share its
+ * STEP port with other such axes. The pulse edges of a shared port are
+ * collected into a mask and toggled with one write to the port's PINx
+ * register, so the pins switch together and the ISR spends fewer cycles
+ * on them.
+ *
+ * Ports and bits come from the pin definitions. The groups are found by
+ * comparing constant port addresses, which the compiler folds away.
+ */
+#if HAS_X_STEP && DISABLED(X_DUAL_STEPPER_DRIVERS) && DISABLED(DUAL_X_CARRIAGE) && DISABLED(INPUT_SHAPING)
+  #define X_GROUP_STEP_PIN X_STEP_PIN
+#endif
+#if HAS_Y_STEP && DISABLED(Y_DUAL_STEPPER_DRIVERS) && DISABLED(INPUT_SHAPING)
+  #define Y_GROUP_STEP_PIN Y_STEP_PIN
+#endif
+#if HAS_Z_STEP && DISABLED(Z_DUAL_STEPPER_DRIVERS)
+  #define Z_GROUP_STEP_PIN Z_STEP_PIN
+#endif
+#if DISABLED(LIN_ADVANCE) && EXTRUDERS == 1 && DISABLED(MIXING_EXTRUDER)
+  #define E_GROUP_STEP_PIN E0_STEP_PIN
+#endif
+
+#define __STEP_RPORT(IO) DIO ## IO ## _RPORT
+#define _STEP_RPORT(IO) __STEP_RPORT(IO)
+#define __STEP_BIT(IO) _BV(DIO ## IO ## _PIN)
+#define _STEP_BIT(IO) __STEP_BIT(IO)
+
+#ifdef X_GROUP_STEP_PIN
+  #define X_GROUP_PORT (&_STEP_RPORT(X_GROUP_STEP_PIN))
+  #define X_GROUP_BIT _STEP_BIT(X_GROUP_STEP_PIN)
+#else
+  #define X_GROUP_PORT ((volatile uint8_t*)NULL)
+  #define X_GROUP_BIT 0
+#endif
+#ifdef Y_GROUP_STEP_PIN
+  #define Y_GROUP_PORT (&_STEP_RPORT(Y_GROUP_STEP_PIN))
+  #define Y_GROUP_BIT _STEP_BIT(Y_GROUP_STEP_PIN)
+#else
+  #define Y_GROUP_PORT ((volatile uint8_t*)NULL)
+  #define Y_GROUP_BIT 0
+#endif
+#ifdef Z_GROUP_STEP_PIN
+  #define Z_GROUP_PORT (&_STEP_RPORT(Z_GROUP_STEP_PIN))
+  #define Z_GROUP_BIT _STEP_BIT(Z_GROUP_STEP_PIN)
+#else
+  #define Z_GROUP_PORT ((volatile uint8_t*)NULL)
+  #define Z_GROUP_BIT 0
+#endif
+#ifdef E_GROUP_STEP_PIN
+  #define E_GROUP_PORT (&_STEP_RPORT(E_GROUP_STEP_PIN))
+  #define E_GROUP_BIT _STEP_BIT(E_GROUP_STEP_PIN)
+#else
+  #define E_GROUP_PORT ((volatile uint8_t*)NULL)
+  #define E_GROUP_BIT 0
+#endif
+
+#define SAME_STEP_PORT(A,B) (A##_GROUP_PORT != NULL && A##_GROUP_PORT == B##_GROUP_PORT)
+
+// An axis is pulsed with its group if any other axis shares its port
+#define STEP_GROUPED(A) (SAME_STEP_PORT(A,X) + SAME_STEP_PORT(A,Y) + SAME_STEP_PORT(A,Z) + SAME_STEP_PORT(A,E) > 1)
+
+// The first axis on each shared port writes the whole group
+#define STEP_GROUP_LEAD_X STEP_GROUPED(X)
+#define STEP_GROUP_LEAD_Y (STEP_GROUPED(Y) && !SAME_STEP_PORT(Y,X))
+#define STEP_GROUP_LEAD_Z (STEP_GROUPED(Z) && !SAME_STEP_PORT(Z,X) && !SAME_STEP_PORT(Z,Y))
+#define STEP_GROUP_LEAD_E (STEP_GROUPED(E) && !SAME_STEP_PORT(E,X) && !SAME_STEP_PORT(E,Y) && !SAME_STEP_PORT(E,Z))
+
+// Flip the BITS of a group. A group port is the PINx register, and writing ones there
+// toggles those PORTx bits in a single store. Unlike a read-modify-write of PORTx it
+// can't undo a change an interrupt makes to another pin of the port in between.
+#define STEP_GROUP_TOGGLE(PORT,BITS) (*(PORT) = (BITS))
+
+#ifdef __AVR__
+
 // intRes = longIn1 * longIn2 >> 24
 // uses:
 // r26 to store 0
@@ -285,6 +403,14 @@ volatile long Stepper::endstops_trigsteps[XYZ];
                  "r26" , "r27" \
                )
 
+#else
+
+// Portable equivalent for host builds, rounded like the assembly version
+#define MultiU24X32toH16(intRes, longIn1, longIn2) \
+  intRes = ((uint64_t)((longIn1) & 0xFFFFFF) * (uint32_t)(longIn2) + 0x800000) >> 24
+
+#endif
+
 // Some useful constants
 
 /**
@@ -328,11 +454,20 @@ void Stepper::set_directions() {
       count_direction[AXIS ##_AXIS] = 1; \
     }
 
-  #if HAS_X_DIR
-    SET_STEP_DIR(X); // A
-  #endif
-  #if HAS_Y_DIR
-    SET_STEP_DIR(Y); // B
+  #if ENABLED(INPUT_SHAPING)
+    // Shaped steps may still be going the other way. pulse_shaped_steps() sets X and Y.
+    count_direction[X_AXIS] = motor_direction(X_AXIS) ? -1 : 1;
+    count_direction[Y_AXIS] = motor_direction(Y_AXIS) ? -1 : 1;
+    #if ENABLED(DUAL_X_CARRIAGE)
+      shaping_dir[X_AXIS] = 0; // The carriage may have changed, and with it the DIR pin
+    #endif
+  #else
+    #if HAS_X_DIR
+      SET_STEP_DIR(X); // A
+    #endif
+    #if HAS_Y_DIR
+      SET_STEP_DIR(Y); // B
+    #endif
   #endif
   #if HAS_Z_DIR
     SET_STEP_DIR(Z); // C
@@ -347,6 +482,9 @@ void Stepper::set_directions() {
       NORM_E_DIR();
       count_direction[E_AXIS] = 1;
     }
+  #else
+    // The advance ISR sets the E direction, but the count follows the block
+    count_direction[E_AXIS] = motor_direction(E_AXIS) ? -1 : 1;
   #endif // !LIN_ADVANCE
 }
 
@@ -363,14 +501,53 @@ void Stepper::set_directions() {
  * OCR1A   Frequency
  *     1     2 MHz
  *    50    40 KHz
- *   100    20 KHz - capped max rate
- *   200    10 KHz - nominal max rate
+ *   100    20 KHz - default MAX_ISR_FREQUENCY
+ *   200    10 KHz - max rate until the ISR run time is measured
  *  2000     1 KHz - sleep rate
  *  4000   500  Hz - init rate
  */
+#if ENABLED(ISR_STATISTICS) || (MULTISTEPPING_LIMIT > 1 && !defined(MULTISTEP_ISR_TICKS))
+
+  // Timer 1 ticks since 'start'. Timer 1 clears when it reaches OCR1A,
+  // so add the period back if that happened in the meantime.
+  FORCE_INLINE uint16_t timer1_ticks_since(const uint16_t start) {
+    uint16_t now = TCNT1;
+    if (TEST(TIFR1, OCF1A)) now += OCR1A;
+    return now - start;
+  }
+
+  // Record a run with interrupts off, then restore the interrupt state
+  #define SAMPLE_TIMER1_ISR(STATS, START) do{ \
+    CRITICAL_SECTION_START \
+      STATS.sample(timer1_ticks_since(START)); \
+    CRITICAL_SECTION_END \
+  }while(0)
+
+  #if ENABLED(ISR_STATISTICS)
+    #define COUNT_ISR_MISS() stepper_isr_stats.miss()
+  #else
+    #define COUNT_ISR_MISS() NOOP
+  #endif
+
+  // Push the next ISR back if it's too close. Either way counts as a missed deadline.
+  #define NEXT_ISR_NOT_TOO_SOON() do{ \
+    const uint16_t soonest = TCNT1 + 16; \
+    if (OCR1A < soonest || TEST(TIFR1, OCF1A)) { NOLESS(OCR1A, soonest); COUNT_ISR_MISS(); } \
+  }while(0)
+
+#else
+
+  #define NEXT_ISR_NOT_TOO_SOON() NOLESS(OCR1A, TCNT1 + 16)
+
+#endif
+
 ISR(TIMER1_COMPA_vect) {
-  #if ENABLED(LIN_ADVANCE)
-    Stepper::advance_isr_scheduler();
+  #if HAS_STEP_ISR_SCHEDULER
+    Stepper::isr_scheduler();
+  #elif ENABLED(ISR_STATISTICS)
+    const uint16_t isr_start = TCNT1;
+    Stepper::isr();
+    SAMPLE_TIMER1_ISR(stepper_isr_stats, isr_start);
   #else
     Stepper::isr();
   #endif
@@ -380,12 +557,16 @@ ISR(TIMER1_COMPA_vect) {
 
 void Stepper::isr() {
 
+  #if MULTISTEPPING_LIMIT > 1 && !defined(MULTISTEP_ISR_TICKS)
+    const uint16_t isr_start = TCNT1;
+  #endif
+
   uint16_t ocr_val;
 
-  #define ENDSTOP_NOMINAL_OCR_VAL 3000 // Check endstops every 1.5ms to guarantee two stepper ISRs within 5ms for BLTouch
-  #define OCR_VAL_TOLERANCE       1000 // First max delay is 2.0ms, last min delay is 0.5ms, all others 1.5ms
+  #define ENDSTOP_NOMINAL_OCR_VAL ((STEPPER_TIMER_RATE) / 2000 * 3) // Check endstops every 1.5ms to guarantee two stepper ISRs within 5ms for BLTouch
+  #define OCR_VAL_TOLERANCE       ((STEPPER_TIMER_RATE) / 2000)     // First max delay is 2.0ms, last min delay is 0.5ms, all others 1.5ms
 
-  #if DISABLED(LIN_ADVANCE)
+  #if !HAS_STEP_ISR_SCHEDULER
     // Disable Timer0 ISRs and enable global ISR again to capture UART events (incoming chars)
     CBI(TIMSK0, OCIE0B); // Temperature ISR
     DISABLE_STEPPER_DRIVER_INTERRUPT();
@@ -417,7 +598,7 @@ void Stepper::isr() {
       ocr_val = step_remaining <= ENDSTOP_NOMINAL_OCR_VAL ? step_remaining : ENDSTOP_NOMINAL_OCR_VAL;
       step_remaining -= ocr_val;
       _NEXT_ISR(ocr_val);
-      NOLESS(OCR1A, TCNT1 + 16);
+      NEXT_ISR_NOT_TOO_SOON();
       _ENABLE_ISRs(); // re-enable ISRs
       return;
     }
@@ -441,7 +622,7 @@ void Stepper::isr() {
       #endif
     }
     current_block = NULL;                       // Prep to get a new block after cleaning
-    _NEXT_ISR(200);                             // Run at max speed - 10 KHz
+    _NEXT_ISR((STEPPER_TIMER_RATE) / 10000);    // Run at max speed - 10 KHz
     _ENABLE_ISRs();
     return;
   }
@@ -453,11 +634,11 @@ void Stepper::isr() {
       trapezoid_generator_reset();
 
       // Initialize Bresenham counters to 1/2 the ceiling
-      counter_X = counter_Y = counter_Z = counter_E = -(current_block->step_event_count >> 1);
+      counter_X = counter_Y = counter_Z = counter_E = -((int32_t)(current_block->step_event_count >> 1));
 
       #if ENABLED(MIXING_EXTRUDER)
         MIXING_STEPPERS_LOOP(i)
-          counter_m[i] = -(current_block->mix_event_count[i] >> 1);
+          counter_m[i] = -((int32_t)(current_block->mix_event_count[i] >> 1));
       #endif
 
       step_events_completed = 0;
@@ -470,14 +651,14 @@ void Stepper::isr() {
       #if ENABLED(Z_LATE_ENABLE)
         if (current_block->steps[Z_AXIS] > 0) {
           enable_Z();
-          _NEXT_ISR(2000); // Run at slow speed - 1 KHz
+          _NEXT_ISR((STEPPER_TIMER_RATE) / 1000); // Run at slow speed - 1 KHz
           _ENABLE_ISRs(); // re-enable ISRs
           return;
         }
       #endif
     }
     else {
-      _NEXT_ISR(2000); // Run at slow speed - 1 KHz
+      _NEXT_ISR((STEPPER_TIMER_RATE) / 1000); // Run at slow speed - 1 KHz
       _ENABLE_ISRs(); // re-enable ISRs
       return;
     }
@@ -495,6 +676,12 @@ void Stepper::isr() {
 
   // Take multiple steps per interrupt (For high speed moves)
   bool all_steps_done = false;
+  #if MULTISTEPPING_LIMIT > 1
+    uint8_t loops_done = step_loops; // Steps taken by this ISR
+    #define LOOPS_TRANSITION(I) (I = loops_transition_interval(I, loops_done))
+  #else
+    #define LOOPS_TRANSITION(I) NOOP
+  #endif
   for (uint8_t i = step_loops; i--;) {
     #if ENABLED(LIN_ADVANCE)
 
@@ -529,14 +716,40 @@ void Stepper::isr() {
     // Advance the Bresenham counter; start a pulse if the axis needs a step
     #define PULSE_START(AXIS) \
       _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
-      if (_COUNTER(AXIS) > 0) { _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); }
+      if (!STEP_GROUPED(AXIS) && _COUNTER(AXIS) > 0) { _APPLY_STEP(AXIS)(!_INVERT_STEP_PIN(AXIS),0); }
 
     // Stop an active pulse, reset the Bresenham counter, update the position
     #define PULSE_STOP(AXIS) \
       if (_COUNTER(AXIS) > 0) { \
         _COUNTER(AXIS) -= current_block->step_event_count; \
         count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
-        _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS),0); \
+        if (!STEP_GROUPED(AXIS)) _APPLY_STEP(AXIS)(_INVERT_STEP_PIN(AXIS),0); \
+      }
+
+    // Port bits of the stepping axes in LEAD's group
+    #define _GROUP_STEP_BIT(LEAD,AXIS) (SAME_STEP_PORT(LEAD,AXIS) && _COUNTER(AXIS) > 0 ? AXIS##_GROUP_BIT : 0)
+
+    // Start or stop the pulses of a port group with one write. The STEP pins are idle
+    // before the start and active before the stop, so both just flip the stepping bits,
+    // whatever the STEP pin inversion. Call before PULSE_STOP, which clears the counters.
+    #define PULSE_GROUP(LEAD) \
+      if (STEP_GROUP_LEAD_##LEAD) \
+        STEP_GROUP_TOGGLE(LEAD##_GROUP_PORT, _GROUP_STEP_BIT(LEAD,X) | _GROUP_STEP_BIT(LEAD,Y) | _GROUP_STEP_BIT(LEAD,Z) | _GROUP_STEP_BIT(LEAD,E))
+
+    #define PULSE_GROUPS() do{ \
+        PULSE_GROUP(X); \
+        PULSE_GROUP(Y); \
+        PULSE_GROUP(Z); \
+        PULSE_GROUP(E); \
+      }while(0)
+
+    // Count the step of a shaped axis for shape_steps(), which steps its impulses
+    #define SHAPED_STEP(AXIS) \
+      _COUNTER(AXIS) += current_block->steps[_AXIS(AXIS)]; \
+      if (_COUNTER(AXIS) > 0) { \
+        _COUNTER(AXIS) -= current_block->step_event_count; \
+        count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+        shaping_steps[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
       }
 
     /**
@@ -606,11 +819,16 @@ void Stepper::isr() {
       uint32_t pulse_start = TCNT0;
     #endif
 
-    #if HAS_X_STEP
-      PULSE_START(X);
-    #endif
-    #if HAS_Y_STEP
-      PULSE_START(Y);
+    #if ENABLED(INPUT_SHAPING)
+      SHAPED_STEP(X);
+      SHAPED_STEP(Y);
+    #else
+      #if HAS_X_STEP
+        PULSE_START(X);
+      #endif
+      #if HAS_Y_STEP
+        PULSE_START(Y);
+      #endif
     #endif
     #if HAS_Z_STEP
       PULSE_START(Z);
@@ -633,6 +851,8 @@ void Stepper::isr() {
       #endif
     #endif // !LIN_ADVANCE
 
+    PULSE_GROUPS(); // Start
+
     // For minimum pulse time wait before stopping pulses
     #if EXTRA_CYCLES_XYZE > 20
       while (EXTRA_CYCLES_XYZE > (uint32_t)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
@@ -641,11 +861,15 @@ void Stepper::isr() {
       DELAY_NOPS(EXTRA_CYCLES_XYZE);
     #endif
 
-    #if HAS_X_STEP
-      PULSE_STOP(X);
-    #endif
-    #if HAS_Y_STEP
-      PULSE_STOP(Y);
+    PULSE_GROUPS(); // Stop
+
+    #if DISABLED(INPUT_SHAPING)
+      #if HAS_X_STEP
+        PULSE_STOP(X);
+      #endif
+      #if HAS_Y_STEP
+        PULSE_STOP(Y);
+      #endif
     #endif
     #if HAS_Z_STEP
       PULSE_STOP(Z);
@@ -671,6 +895,9 @@ void Stepper::isr() {
 
     if (++step_events_completed >= current_block->step_event_count) {
       all_steps_done = true;
+      #if MULTISTEPPING_LIMIT > 1
+        loops_done -= i; // The block ended partway through the burst
+      #endif
       break;
     }
 
@@ -683,69 +910,77 @@ void Stepper::isr() {
 
   } // steps_loop
 
-  #if ENABLED(LIN_ADVANCE)
-
-    if (current_block->use_advance_lead) {
-      const int delta_adv_steps = current_estep_rate[TOOL_E_INDEX] - current_adv_steps[TOOL_E_INDEX];
-      current_adv_steps[TOOL_E_INDEX] += delta_adv_steps;
-      #if ENABLED(MIXING_EXTRUDER)
-        // Mixing extruders apply advance lead proportionally
-        MIXING_STEPPERS_LOOP(j)
-          e_steps[j] += delta_adv_steps * current_block->step_event_count / current_block->mix_event_count[j];
-      #else
-        // For most extruders, advance the single E stepper
-        e_steps[TOOL_E_INDEX] += delta_adv_steps;
-      #endif
-    }
-    // If we have esteps to execute, fire the next advance_isr "now"
-    if (e_steps[TOOL_E_INDEX]) nextAdvanceISR = 0;
+  #if ENABLED(INPUT_SHAPING)
+    shape_steps();
+  #endif
 
-  #endif // LIN_ADVANCE
+  #if ENABLED(LIN_ADVANCE)
+    // Extruder steps from this ISR go out right away. Pressure steps have their own timer.
+    pulse_e_steps();
+  #endif
 
   // Calculate new timer value
   if (step_events_completed <= (uint32_t)current_block->accelerate_until) {
 
-    MultiU24X32toH16(acc_step_rate, acceleration_time, current_block->acceleration_rate);
-    acc_step_rate += current_block->initial_rate;
+    uint16_t interval;
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      if (!next_segment(acc_step_rate, interval))
+    #endif
+    {
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // Jerk-limited rate for the elapsed acceleration time
+        acc_step_rate = (uint32_t)acceleration_time < current_block->acceleration_time
+          ? _eval_bezier_curve(acceleration_time)
+          : current_block->cruise_rate;
+      #else
+        MultiU24X32toH16(acc_step_rate, acceleration_time, current_block->acceleration_rate);
+        acc_step_rate += current_block->initial_rate;
+      #endif
 
-    // upper limit
-    NOMORE(acc_step_rate, current_block->nominal_rate);
+      // upper limit
+      NOMORE(acc_step_rate, current_block->nominal_rate);
 
-    // step_rate to timer interval
-    const uint16_t interval = calc_timer_interval(acc_step_rate);
+      // step_rate to timer interval
+      interval = calc_timer_interval(acc_step_rate);
+    }
+    LOOPS_TRANSITION(interval);
 
     SPLIT(interval);  // split step into multiple ISRs if larger than ENDSTOP_NOMINAL_OCR_VAL
     _NEXT_ISR(ocr_val);
 
     acceleration_time += interval;
-
-    #if ENABLED(LIN_ADVANCE)
-
-      if (current_block->use_advance_lead) {
-        #if ENABLED(MIXING_EXTRUDER)
-          MIXING_STEPPERS_LOOP(j)
-            current_estep_rate[j] = ((uint32_t)acc_step_rate * current_block->abs_adv_steps_multiplier8 * current_block->step_event_count / current_block->mix_event_count[j]) >> 17;
-        #else
-          current_estep_rate[TOOL_E_INDEX] = ((uint32_t)acc_step_rate * current_block->abs_adv_steps_multiplier8) >> 17;
-        #endif
-      }
-      eISR_Rate = adv_rate(e_steps[TOOL_E_INDEX], interval, step_loops);
-
-    #endif // LIN_ADVANCE
   }
   else if (step_events_completed > (uint32_t)current_block->decelerate_after) {
-    uint16_t step_rate;
-    MultiU24X32toH16(step_rate, deceleration_time, current_block->acceleration_rate);
+    uint16_t step_rate, interval;
 
-    if (step_rate < acc_step_rate) { // Still decelerating?
-      step_rate = acc_step_rate - step_rate;
-      NOLESS(step_rate, current_block->final_rate);
-    }
-    else
-      step_rate = current_block->final_rate;
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      if (!next_segment(step_rate, interval))
+    #endif
+    {
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // First deceleration step of this block? Set up the S-curve down to the final rate.
+        if (!bezier_2nd_half) {
+          _calc_bezier_curve_coeffs(current_block->cruise_rate, current_block->final_rate, current_block->deceleration_time_inverse);
+          bezier_2nd_half = true;
+        }
+        step_rate = (uint32_t)deceleration_time < current_block->deceleration_time
+          ? _eval_bezier_curve(deceleration_time)
+          : current_block->final_rate;
+      #else
+        MultiU24X32toH16(step_rate, deceleration_time, current_block->acceleration_rate);
+
+        if (step_rate < acc_step_rate) { // Still decelerating?
+          step_rate = acc_step_rate - step_rate;
+          NOLESS(step_rate, current_block->final_rate);
+        }
+        else
+          step_rate = current_block->final_rate;
+      #endif
 
-    // step_rate to timer interval
-    const uint16_t interval = calc_timer_interval(step_rate);
+      // step_rate to timer interval
+      interval = calc_timer_interval(step_rate);
+    }
+    LOOPS_TRANSITION(interval);
 
     SPLIT(interval);  // split step into multiple ISRs if larger than ENDSTOP_NOMINAL_OCR_VAL
     _NEXT_ISR(ocr_val);
@@ -753,39 +988,27 @@ void Stepper::isr() {
     deceleration_time += interval;
 
     #if ENABLED(LIN_ADVANCE)
-
-      if (current_block->use_advance_lead) {
-        #if ENABLED(MIXING_EXTRUDER)
-          MIXING_STEPPERS_LOOP(j)
-            current_estep_rate[j] = ((uint32_t)step_rate * current_block->abs_adv_steps_multiplier8 * current_block->step_event_count / current_block->mix_event_count[j]) >> 17;
-        #else
-          current_estep_rate[TOOL_E_INDEX] = ((uint32_t)step_rate * current_block->abs_adv_steps_multiplier8) >> 17;
-        #endif
+      // Start releasing pressure toward the exit speed
+      if (!LA_decelerating) {
+        LA_decelerating = true;
+        if (nextAdvanceISR == ISR_NEVER) nextAdvanceISR = 0;
       }
-      eISR_Rate = adv_rate(e_steps[TOOL_E_INDEX], interval, step_loops);
-
-    #endif // LIN_ADVANCE
+    #endif
   }
   else {
 
-    #if ENABLED(LIN_ADVANCE)
-
-      if (current_block->use_advance_lead)
-        current_estep_rate[TOOL_E_INDEX] = final_estep_rate;
+    // ensure we're running at the correct step rate, even if we just came off an acceleration
+    step_loops = step_loops_nominal;
 
-      eISR_Rate = adv_rate(e_steps[TOOL_E_INDEX], OCR1A_nominal, step_loops_nominal);
+    uint16_t interval = OCR1A_nominal;
+    LOOPS_TRANSITION(interval);
 
-    #endif
-
-    SPLIT(OCR1A_nominal);  // split step into multiple ISRs if larger than ENDSTOP_NOMINAL_OCR_VAL
+    SPLIT(interval);  // split step into multiple ISRs if larger than ENDSTOP_NOMINAL_OCR_VAL
     _NEXT_ISR(ocr_val);
-
-    // ensure we're running at the correct step rate, even if we just came off an acceleration
-    step_loops = step_loops_nominal;
   }
 
-  #if DISABLED(LIN_ADVANCE)
-    NOLESS(OCR1A, TCNT1 + 16);
+  #if !HAS_STEP_ISR_SCHEDULER
+    NEXT_ISR_NOT_TOO_SOON();
   #endif
 
   // If current block is finished, reset pointer
@@ -793,7 +1016,23 @@ void Stepper::isr() {
     current_block = NULL;
     planner.discard_current_block();
   }
-  #if DISABLED(LIN_ADVANCE)
+
+  #if MULTISTEPPING_LIMIT > 1 && !defined(MULTISTEP_ISR_TICKS)
+    // Interrupts are on while stepping, so a nested ISR can only lengthen a run.
+    // Of two runs in a row the shorter is closest to the ISR's own run time.
+    static uint16_t last_ticks = 0;
+    const uint16_t run_ticks = timer1_ticks_since(isr_start),
+                   ticks = min(run_ticks, last_ticks);
+    last_ticks = run_ticks;
+
+    // Take up a longer run time at once, but let it fall back slowly
+    if (ticks > isr_ticks)
+      isr_ticks = ticks > 255 ? 255 : (isr_ticks + ticks + 1) >> 1;
+    else
+      isr_ticks -= (isr_ticks - ticks + 15) >> 4;
+  #endif
+
+  #if !HAS_STEP_ISR_SCHEDULER
     _ENABLE_ISRs(); // re-enable ISRs
   #endif
 }
@@ -803,11 +1042,52 @@ void Stepper::isr() {
   #define CYCLES_EATEN_E (E_STEPPERS * 5)
   #define EXTRA_CYCLES_E (STEP_PULSE_CYCLES - (CYCLES_EATEN_E))
 
-  // Timer interrupt for E. e_steps is set in the main routine;
-
+  /**
+   * Timer interrupt for the pressure advance steps.
+   *
+   * The planner gives each block the pressure (in E steps) for its nominal and exit
+   * speeds, and the timer interval that ramps the pressure at the block acceleration.
+   * This adds one pressure step per interval while accelerating or cruising below
+   * the nominal pressure, removes one per interval while decelerating down to the exit
+   * pressure, and goes idle once the pressure is where it belongs.
+   */
   void Stepper::advance_isr() {
 
-    nextAdvanceISR = eISR_Rate;
+    nextAdvanceISR = ISR_NEVER;
+
+    int &adv_steps = current_adv_steps[LA_active_extruder];
+    if (LA_decelerating) {
+      if (adv_steps > LA_final_adv_steps) {
+        adv_steps--;
+        e_steps[LA_active_extruder]--;
+        nextAdvanceISR = LA_advance_speed;
+      }
+    }
+    else if (adv_steps < LA_max_adv_steps) {
+      adv_steps++;
+      e_steps[LA_active_extruder]++;
+      nextAdvanceISR = LA_advance_speed;
+    }
+
+    pulse_e_steps();
+  }
+
+  // Step the E steppers until e_steps, set by both ISRs, are all done
+  void Stepper::pulse_e_steps() {
+
+    #if E_STEPPERS > 4
+      #define E_STEPS_PENDING() (e_steps[0] || e_steps[1] || e_steps[2] || e_steps[3] || e_steps[4])
+    #elif E_STEPPERS > 3
+      #define E_STEPS_PENDING() (e_steps[0] || e_steps[1] || e_steps[2] || e_steps[3])
+    #elif E_STEPPERS > 2
+      #define E_STEPS_PENDING() (e_steps[0] || e_steps[1] || e_steps[2])
+    #elif E_STEPPERS > 1
+      #define E_STEPS_PENDING() (e_steps[0] || e_steps[1])
+    #else
+      #define E_STEPS_PENDING() (e_steps[0])
+    #endif
+
+    if (!E_STEPS_PENDING()) return;
 
     #if ENABLED(MK2_MULTIPLEXER)
       // Even-numbered steppers are reversed
@@ -842,7 +1122,7 @@ void Stepper::isr() {
     #endif
 
     // Step all E steppers that have steps
-    for (uint8_t i = step_loops; i--;) {
+    for (;;) {
 
       #if EXTRA_CYCLES_E > 20
         uint32_t pulse_start = TCNT0;
@@ -884,55 +1164,388 @@ void Stepper::isr() {
         #endif
       #endif
 
+      if (!E_STEPS_PENDING()) break;
+
       // For minimum pulse time wait before looping
       #if EXTRA_CYCLES_E > 20
-        if (i) while (EXTRA_CYCLES_E > (uint32_t)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+        while (EXTRA_CYCLES_E > (uint32_t)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
       #elif EXTRA_CYCLES_E > 0
-        if (i) DELAY_NOPS(EXTRA_CYCLES_E);
+        DELAY_NOPS(EXTRA_CYCLES_E);
       #endif
 
     } // steps_loop
   }
 
-  void Stepper::advance_isr_scheduler() {
+#endif // LIN_ADVANCE
+
+#if ENABLED(INPUT_SHAPING)
+
+  #define CYCLES_EATEN_XY 10
+  #define EXTRA_CYCLES_XY (STEP_PULSE_CYCLES - (CYCLES_EATEN_XY))
+
+  /**
+   * Apply the first impulse of the X and Y steps just counted by the main ISR,
+   * and queue the steps for the delayed impulses.
+   */
+  void Stepper::shape_steps() {
+    if (!shaping_steps[X_AXIS] && !shaping_steps[Y_AXIS]) return;
+
+    for (uint8_t a = 0; a < 2; a++) {
+      shaping_sum[a] += shaping_amplitude[a][0] * shaping_steps[a];
+      shaping_pending[a] += shaping_steps[a];
+    }
+
+    if (shaping_axes) {
+      const uint8_t next = SHAPING_MOD(shaping_head + 1);
+      uint32_t soonest = UINT32_MAX;
+      for (uint8_t a = 0; a < 2; a++) if (TEST(shaping_axes, a)) {
+        for (uint8_t i = 1; i < SHAPING_IMPULSES; i++) {
+          // Buffer full? Apply the oldest impulse early rather than lose its steps.
+          const uint8_t echo = shaping_echo[a][i - 1];
+          if (echo == next) {
+            shaping_sum[a] += shaping_amplitude[a][i] * shaping_queue[echo].steps[a];
+            shaping_echo[a][i - 1] = SHAPING_MOD(echo + 1);
+          }
+        }
+        NOMORE(soonest, shaping_delay[a][1]);
+      }
+
+      shaping_event_t &event = shaping_queue[shaping_head];
+      event.time = shaping_clock;
+      event.steps[X_AXIS] = shaping_steps[X_AXIS];
+      event.steps[Y_AXIS] = shaping_steps[Y_AXIS];
+      shaping_head = next;
+
+      // Nothing else pending? Wake up for the first delayed impulse.
+      if (nextShapingISR == ISR_NEVER) nextShapingISR = min(soonest, (uint32_t)(ISR_NEVER - 1));
+    }
+
+    shaping_steps[X_AXIS] = shaping_steps[Y_AXIS] = 0;
+    pulse_shaped_steps();
+  }
+
+  /**
+   * Timer interrupt for the delayed impulses of the queued X and Y steps.
+   * Applies all impulses that are due and sleeps until the next one.
+   */
+  void Stepper::shaping_isr() {
+    uint32_t soonest = UINT32_MAX;
+    for (uint8_t a = 0; a < 2; a++) if (TEST(shaping_axes, a)) {
+      for (uint8_t i = 1; i < SHAPING_IMPULSES; i++) {
+        // Steps taken up to this time have their impulse due now
+        const uint32_t due = shaping_clock - shaping_delay[a][i];
+        uint8_t echo = shaping_echo[a][i - 1];
+        while (echo != shaping_head) {
+          const shaping_event_t &event = shaping_queue[echo];
+          const int32_t wait = event.time - due;
+          if (wait > 0) { NOMORE(soonest, (uint32_t)wait); break; }
+          shaping_sum[a] += shaping_amplitude[a][i] * event.steps[a];
+          echo = SHAPING_MOD(echo + 1);
+        }
+        shaping_echo[a][i - 1] = echo;
+      }
+    }
+    nextShapingISR = soonest == UINT32_MAX ? ISR_NEVER : min(soonest, (uint32_t)(ISR_NEVER - 1));
+
+    pulse_shaped_steps();
+  }
+
+  // Step X and Y while their impulses add up to at least half a step
+  void Stepper::pulse_shaped_steps() {
+    #define SHAPED_STEP_DIR(A) (shaping_sum[A] >= 128 ? 1 : shaping_sum[A] < -128 ? -1 : 0)
+
+    int8_t dx = SHAPED_STEP_DIR(X_AXIS), dy = SHAPED_STEP_DIR(Y_AXIS);
+    while (dx || dy) {
+
+      // Only a reversal needs the direction pins, and then the setup time
+      bool reversed = false;
+      if (dx && dx != shaping_dir[X_AXIS]) {
+        X_APPLY_DIR(dx > 0 ? !INVERT_X_DIR : INVERT_X_DIR, false);
+        shaping_dir[X_AXIS] = dx;
+        reversed = true;
+      }
+      if (dy && dy != shaping_dir[Y_AXIS]) {
+        Y_APPLY_DIR(dy > 0 ? !INVERT_Y_DIR : INVERT_Y_DIR, false);
+        shaping_dir[Y_AXIS] = dy;
+        reversed = true;
+      }
+      if (reversed) {
+        #if DIR_SETUP_CYCLES > 20
+          const uint32_t dir_start = TCNT0;
+          while (DIR_SETUP_CYCLES > (uint32_t)(TCNT0 - dir_start) * (INT0_PRESCALER)) { /* nada */ }
+        #elif DIR_SETUP_CYCLES > 0
+          DELAY_NOPS(DIR_SETUP_CYCLES);
+        #endif
+      }
+
+      #if EXTRA_CYCLES_XY > 20
+        uint32_t pulse_start = TCNT0;
+      #endif
+
+      if (dx) X_APPLY_STEP(!INVERT_X_STEP_PIN, 0);
+      if (dy) Y_APPLY_STEP(!INVERT_Y_STEP_PIN, 0);
+
+      // For minimum pulse time wait before stopping pulses
+      #if EXTRA_CYCLES_XY > 20
+        while (EXTRA_CYCLES_XY > (uint32_t)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+        pulse_start = TCNT0;
+      #elif EXTRA_CYCLES_XY > 0
+        DELAY_NOPS(EXTRA_CYCLES_XY);
+      #endif
+
+      if (dx) {
+        shaping_sum[X_AXIS] -= dx > 0 ? 256 : -256;
+        shaping_pending[X_AXIS] -= dx;
+        X_APPLY_STEP(INVERT_X_STEP_PIN, 0);
+      }
+      if (dy) {
+        shaping_sum[Y_AXIS] -= dy > 0 ? 256 : -256;
+        shaping_pending[Y_AXIS] -= dy;
+        Y_APPLY_STEP(INVERT_Y_STEP_PIN, 0);
+      }
+
+      dx = SHAPED_STEP_DIR(X_AXIS);
+      dy = SHAPED_STEP_DIR(Y_AXIS);
+
+      // For minimum pulse time wait before looping
+      if (dx || dy) {
+        #if EXTRA_CYCLES_XY > 20
+          while (EXTRA_CYCLES_XY > (uint32_t)(TCNT0 - pulse_start) * (INT0_PRESCALER)) { /* nada */ }
+        #elif EXTRA_CYCLES_XY > 0
+          DELAY_NOPS(EXTRA_CYCLES_XY);
+        #endif
+      }
+    }
+  }
+
+  /**
+   * Drop all X and Y impulses not yet stepped, as on a quick stop or an endstop hit.
+   * The counted steps that will never be taken come off count_position so it keeps
+   * matching the carriage. Call from the Stepper ISR or with it disabled.
+   */
+  void Stepper::discard_shaping() {
+    for (uint8_t a = 0; a < 2; a++) {
+      count_position[a] -= shaping_pending[a] + shaping_steps[a];
+      shaping_pending[a] = shaping_sum[a] = 0;
+      shaping_steps[a] = 0;
+      for (uint8_t i = 0; i < SHAPING_IMPULSES - 1; i++) shaping_echo[a][i] = shaping_head;
+    }
+    nextShapingISR = ISR_NEVER;
+  }
+
+  /**
+   * Work out the impulses of each axis from its frequency and damping ratio.
+   *
+   * With K = exp(-zeta * PI / sqrt(1 - zeta^2)), impulses come every half of the
+   * damped period and are sized (before normalizing to 256):
+   *
+   *   ZV:  1, K
+   *   ZVD: 1, 2K, K^2
+   *   EI:  (1 + V) / 4, (1 - V) / 2 * K, (1 + V) / 4 * K^2   (V = 5% vibration tolerance)
+   */
+  void Stepper::refresh_shaping() {
+    synchronize(); // Let all queued impulses out first
+
+    int16_t amplitude[2][SHAPING_IMPULSES];
+    uint32_t delay[2][SHAPING_IMPULSES], longest = 0;
+    uint8_t axes = 0;
+
+    for (uint8_t a = 0; a < 2; a++) {
+      float impulse[SHAPING_IMPULSES] = { 1 }, half_period = 0;
+      if (shaping_frequency[a] > 0) {
+        SBI(axes, a);
+        const float zeta = constrain(shaping_zeta[a], 0, 0.99),
+                    damped = SQRT(1 - sq(zeta)),
+                    K = exp(-zeta * M_PI / damped);
+        half_period = 0.5 / (shaping_frequency[a] * damped);
+        #if ENABLED(INPUT_SHAPING_EI)
+          const float vtol = 0.05;
+          impulse[0] = 0.25 * (1 + vtol);
+          impulse[1] = 0.5 * (1 - vtol) * K;
+          impulse[2] = impulse[0] * sq(K);
+        #elif ENABLED(INPUT_SHAPING_ZVD)
+          impulse[1] = 2 * K;
+          impulse[2] = sq(K);
+        #else
+          impulse[1] = K;
+        #endif
+      }
+
+      float total = 0;
+      for (uint8_t i = 0; i < SHAPING_IMPULSES; i++) total += impulse[i];
+
+      // The first impulse takes the rounding, so each step still adds up to 256
+      int16_t rest = 256;
+      for (uint8_t i = 1; i < SHAPING_IMPULSES; i++) {
+        amplitude[a][i] = LROUND(impulse[i] * 256 / total);
+        rest -= amplitude[a][i];
+        delay[a][i] = half_period * i * (STEPPER_TIMER_RATE);
+      }
+      amplitude[a][0] = rest;
+      delay[a][0] = 0;
+      NOLESS(longest, delay[a][SHAPING_IMPULSES - 1]);
+    }
+
+    CRITICAL_SECTION_START;
+      COPY(shaping_amplitude, amplitude);
+      COPY(shaping_delay, delay);
+      shaping_axes = axes;
+      for (uint8_t a = 0; a < 2; a++)
+        for (uint8_t i = 0; i < SHAPING_IMPULSES - 1; i++)
+          shaping_echo[a][i] = shaping_head;
+      // Main ISRs come no closer than this, so the queue holds the longest delay
+      shaping_min_interval = min(longest / (SHAPING_BUFFER_SIZE - 1), 65535UL);
+    CRITICAL_SECTION_END;
+
+    // Multi-stepping keeps the ISR that far apart. Beyond that the planner slows X and Y down.
+    const uint32_t rate = shaping_min_interval ? (STEPPER_TIMER_RATE) * (MULTISTEPPING_LIMIT) / shaping_min_interval : UINT32_MAX;
+    shaping_max_rate = rate < MAX_STEP_FREQUENCY ? rate : UINT32_MAX;
+  }
+
+  void Stepper::set_shaping(const AxisEnum axis, const float &freq, const float &zeta) {
+    #if CORE_IS_XY
+      // The A and B motors both move X and Y, so they share one shaper
+      UNUSED(axis);
+      shaping_frequency[X_AXIS] = shaping_frequency[Y_AXIS] = freq;
+      shaping_zeta[X_AXIS] = shaping_zeta[Y_AXIS] = zeta;
+    #else
+      shaping_frequency[axis] = freq;
+      shaping_zeta[axis] = zeta;
+    #endif
+    refresh_shaping();
+  }
+
+  long Stepper::shaped_stepper_position(const AxisEnum axis) {
+    CRITICAL_SECTION_START;
+    const long count_pos = count_position[axis] - (axis == X_AXIS || axis == Y_AXIS ? shaping_pending[axis] : 0);
+    CRITICAL_SECTION_END;
+    return count_pos;
+  }
+
+  /**
+   * M593: Set or report input shaping
+   *
+   *   X, Y  Axis to set. Both if neither is given. (CoreXY always sets both.)
+   *   F     Frequency to cancel (Hz). 0 turns shaping off.
+   *   D     Damping ratio, 0 to 0.99
+   *
+   * With no F or D, report the current settings.
+   */
+  void gcode_M593() {
+    const bool seen_x = parser.seen('X'), seen_y = parser.seen('Y'),
+               set_x = seen_x || !seen_y, set_y = seen_y || !seen_x;
+
+    if (!parser.seen('F') && !parser.seen('D')) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPAIR("M593 X F", stepper.shaping_frequency[X_AXIS]);
+      SERIAL_ECHOPAIR(" D", stepper.shaping_zeta[X_AXIS]);
+      SERIAL_ECHOPAIR(" Y F", stepper.shaping_frequency[Y_AXIS]);
+      SERIAL_ECHOLNPAIR(" D", stepper.shaping_zeta[Y_AXIS]);
+      return;
+    }
+
+    const float freq = parser.floatval('F', stepper.shaping_frequency[set_x ? X_AXIS : Y_AXIS]),
+                zeta = parser.floatval('D', stepper.shaping_zeta[set_x ? X_AXIS : Y_AXIS]);
+    if (freq < 0 || !WITHIN(zeta, 0, 0.99)) {
+      SERIAL_ERROR_START();
+      SERIAL_ERRORLNPGM("?F must be >= 0 and D 0 to 0.99.");
+      return;
+    }
+
+    #if CORE_IS_XY
+      UNUSED(set_y);
+      stepper.set_shaping(X_AXIS, freq, zeta);
+    #else
+      if (set_x) stepper.shaping_frequency[X_AXIS] = freq, stepper.shaping_zeta[X_AXIS] = zeta;
+      if (set_y) stepper.shaping_frequency[Y_AXIS] = freq, stepper.shaping_zeta[Y_AXIS] = zeta;
+      stepper.refresh_shaping();
+    #endif
+  }
+
+#endif // INPUT_SHAPING
+
+#if HAS_STEP_ISR_SCHEDULER
+
+  // Timer 1 serves the main ISR and the extra step ISRs, each on its own interval
+  void Stepper::isr_scheduler() {
     // Disable Timer0 ISRs and enable global ISR again to capture UART events (incoming chars)
     CBI(TIMSK0, OCIE0B); // Temperature ISR
     DISABLE_STEPPER_DRIVER_INTERRUPT();
     sei();
 
-    // Run main stepping ISR if flagged
-    if (!nextMainISR) isr();
+    #if ENABLED(ISR_STATISTICS)
 
-    // Run Advance stepping ISR if flagged
-    if (!nextAdvanceISR) advance_isr();
+      // Time each ISR separately
+      if (!nextMainISR) {
+        const uint16_t isr_start = TCNT1;
+        isr();
+        SAMPLE_TIMER1_ISR(stepper_isr_stats, isr_start);
+      }
 
-    // Is the next advance ISR scheduled before the next main ISR?
-    if (nextAdvanceISR <= nextMainISR) {
-      // Set up the next interrupt
-      OCR1A = nextAdvanceISR;
-      // New interval for the next main ISR
-      if (nextMainISR) nextMainISR -= nextAdvanceISR;
-      // Will call Stepper::advance_isr on the next interrupt
-      nextAdvanceISR = 0;
-    }
-    else {
-      // The next main ISR comes first
-      OCR1A = nextMainISR;
-      // New interval for the next advance ISR, if any
-      if (nextAdvanceISR && nextAdvanceISR != ADV_NEVER)
-        nextAdvanceISR -= nextMainISR;
-      // Will call Stepper::isr on the next interrupt
-      nextMainISR = 0;
-    }
+      #if ENABLED(LIN_ADVANCE)
+        if (!nextAdvanceISR) {
+          const uint16_t isr_start = TCNT1;
+          advance_isr();
+          SAMPLE_TIMER1_ISR(advance_isr_stats, isr_start);
+        }
+      #endif
+
+      #if ENABLED(INPUT_SHAPING)
+        if (!nextShapingISR) {
+          const uint16_t isr_start = TCNT1;
+          shaping_isr();
+          SAMPLE_TIMER1_ISR(shaping_isr_stats, isr_start);
+        }
+      #endif
+
+    #else
+
+      // Run main stepping ISR if flagged
+      if (!nextMainISR) isr();
+
+      // Run Advance stepping ISR if flagged
+      #if ENABLED(LIN_ADVANCE)
+        if (!nextAdvanceISR) advance_isr();
+      #endif
+
+      // Run the delayed shaping impulses if flagged
+      #if ENABLED(INPUT_SHAPING)
+        if (!nextShapingISR) shaping_isr();
+      #endif
+
+    #endif
+
+    // Sleep until the soonest ISR is due
+    uint16_t interval = nextMainISR;
+    #if ENABLED(LIN_ADVANCE)
+      NOMORE(interval, nextAdvanceISR);
+    #endif
+    #if ENABLED(INPUT_SHAPING)
+      NOMORE(interval, nextShapingISR);
+    #endif
+    OCR1A = interval;
+
+    // The ISRs at 0 run on the next interrupt
+    nextMainISR -= interval;
+    #if ENABLED(LIN_ADVANCE)
+      if (nextAdvanceISR != ISR_NEVER) nextAdvanceISR -= interval;
+    #endif
+    #if ENABLED(INPUT_SHAPING)
+      if (nextShapingISR != ISR_NEVER) nextShapingISR -= interval;
+    #endif
 
     // Don't run the ISR faster than possible
-    NOLESS(OCR1A, TCNT1 + 16);
+    NEXT_ISR_NOT_TOO_SOON();
+
+    #if ENABLED(INPUT_SHAPING)
+      shaping_clock += OCR1A; // The time of the next interrupt
+    #endif
 
     // Restore original ISR settings
     _ENABLE_ISRs();
   }
 
-#endif // LIN_ADVANCE
+#endif // HAS_STEP_ISR_SCHEDULER
 
 void Stepper::init() {
 
@@ -1115,10 +1728,13 @@ void Stepper::init() {
 
   // Set the timer pre-scaler
   // Generally we use a divider of 8, resulting in a 2MHz timer
-  // frequency on a 16MHz MCU. If you are going to change this, be
-  // sure to regenerate speed_lookuptable.h with
-  // create_speed_lookuptable.py
-  SET_CS(1, PRESCALER_8);  //  CS 2 = 1/8 prescaler
+  // frequency on a 16MHz MCU. The step rate tables in
+  // speed_lookuptable.h are generated to match.
+  #if STEPPER_TIMER_PRESCALE == 64
+    SET_CS(1, PRESCALER_64); //  CS 3 = 1/64 prescaler
+  #else
+    SET_CS(1, PRESCALER_8);  //  CS 2 = 1/8 prescaler
+  #endif
 
   // Init Stepper ISR to 122 Hz for quick starting
   OCR1A = 0x4000;
@@ -1137,10 +1753,159 @@ void Stepper::init() {
 }
 
 
+#if ENABLED(STEP_SEGMENT_BUFFER)
+
+  #define SEGMENT_NEXT(i) (((i) + 1) & (STEP_SEGMENT_BUFFER_SIZE - 1))
+  #define SEGMENT_TICKS   ((STEPPER_TIMER_RATE) / 1000UL * (STEP_SEGMENT_US) / 1000UL)
+
+  /**
+   * Fill the segment buffer for the block the ISR is running. Call often from the main loop.
+   *
+   * This walks the block the same way the ISR will, evaluating the rate once per
+   * segment instead of once per ISR, so acceleration and deceleration proceed in
+   * steps of about STEP_SEGMENT_US. Cruise needs no segments: the block already
+   * has its nominal timer.
+   *
+   * Whenever the ISR calculates a rate itself (the buffer ran dry or a new block
+   * began) it bumps segment_sync. The prep cursor then restarts from the ISR state
+   * and a segment prepared from the old cursor is dropped.
+   */
+  void Stepper::prep_segments() {
+    for (;;) {
+      block_t *block;
+      bool full;
+
+      CRITICAL_SECTION_START
+        block = current_block;
+        full = SEGMENT_NEXT(segment_buffer_head) == segment_buffer_tail;
+        if (block && prep_sync != segment_sync) {
+          // The buffer is empty. Begin at the ISR's next rate calculation.
+          prep_sync = segment_sync;
+          prep_step_events = step_events_completed + step_loops;
+          prep_acceleration_time = acceleration_time;
+          prep_deceleration_time = deceleration_time;
+          prep_acc_step_rate = acc_step_rate;
+          prep_step_loops = step_loops;
+        }
+      CRITICAL_SECTION_END
+
+      if (!block || full) return;
+
+      const uint32_t step_event_count = block->step_event_count,
+                     accelerate_until = block->accelerate_until,
+                     decelerate_after = block->decelerate_after;
+
+      // The ISR takes its last rate when the block's final step is done
+      uint32_t events = prep_step_events;
+      if (events > step_event_count) return;        // Block fully prepared
+
+      // Skip over the cruise, which runs at the nominal timer and step loops
+      if (events > accelerate_until && events <= decelerate_after) {
+        if (decelerate_after >= step_event_count) {
+          prep_step_events = step_event_count + 1;  // Cruise to the end
+          return;
+        }
+        const uint8_t loops = block->nominal_step_loops;
+        events += ((decelerate_after - events) / loops + 1) * loops;
+        NOMORE(events, step_event_count);
+        prep_step_events = events;
+        prep_step_loops = loops;
+      }
+
+      const bool accelerating = events <= accelerate_until;
+      uint16_t step_rate, acc_rate = prep_acc_step_rate;
+      uint32_t phase_end;
+
+      if (accelerating) {
+        MultiU24X32toH16(step_rate, prep_acceleration_time, block->acceleration_rate);
+        step_rate += block->initial_rate;
+        NOMORE(step_rate, block->nominal_rate);
+        acc_rate = step_rate;
+        phase_end = accelerate_until;
+      }
+      else {
+        MultiU24X32toH16(step_rate, prep_deceleration_time, block->acceleration_rate);
+        if (step_rate < acc_rate) {
+          step_rate = acc_rate - step_rate;
+          NOLESS(step_rate, block->final_rate);
+        }
+        else
+          step_rate = block->final_rate;
+        phase_end = step_event_count;
+      }
+
+      step_segment_t seg;
+      seg.step_rate = step_rate;
+      seg.step_loops = prep_step_loops;
+      seg.interval = calc_timer_interval(step_rate, seg.step_loops);
+
+      // As many ISRs as fit in the segment time, staying inside the phase
+      uint32_t count = SEGMENT_TICKS / seg.interval;
+      NOLESS(count, 1UL);
+      NOMORE(count, (phase_end - events) / seg.step_loops + 1);
+      NOMORE(count, 255UL);
+      seg.isr_count = count;
+
+      // The cursor after this segment
+      const uint32_t last = events + (count - 1) * seg.step_loops;
+      events = last >= step_event_count ? step_event_count + 1 : min(last + seg.step_loops, step_event_count);
+      const long ticks = count * seg.interval;
+
+      // Queue the segment unless the ISR moved on while it was being prepared
+      bool stale;
+      {
+        CRITICAL_SECTION_START
+          stale = prep_sync != segment_sync;
+          if (!stale) {
+            segment_buffer[segment_buffer_head] = seg;
+            segment_buffer_head = SEGMENT_NEXT(segment_buffer_head);
+          }
+        CRITICAL_SECTION_END
+      }
+
+      if (!stale) {
+        prep_step_events = events;
+        prep_acc_step_rate = acc_rate;
+        prep_step_loops = seg.step_loops;
+        if (accelerating)
+          prep_acceleration_time += ticks;
+        else
+          prep_deceleration_time += ticks;
+      }
+    }
+  }
+
+#endif // STEP_SEGMENT_BUFFER
+
 /**
  * Block until all buffered steps are executed / cleaned
  */
-void Stepper::synchronize() { while (planner.blocks_queued() || cleaning_buffer_counter) idle(); }
+void Stepper::synchronize() {
+  #if ENABLED(SEGMENT_MERGE)
+    planner.flush_merged_segment();
+  #endif
+  while (planner.blocks_queued() || cleaning_buffer_counter) {
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      prep_segments();
+    #endif
+    idle();
+  }
+  #if ENABLED(INPUT_SHAPING)
+    while (shaping_busy()) idle(); // Let the delayed impulses out
+  #endif
+  #if ENABLED(BLOCK_SYNC_EVENTS)
+    planner.apply_sync_events();
+  #endif
+}
+
+void Stepper::wait_for_block(const uint32_t sequence) {
+  while (planner.blocks_queued() && !planner.block_done(sequence)) {
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      prep_segments();
+    #endif
+    idle();
+  }
+}
 
 /**
  * Set the stepper positions directly in steps
@@ -1196,6 +1961,27 @@ void Stepper::set_e_position(const long &e) {
   CRITICAL_SECTION_END;
 }
 
+/**
+ * Move an axis position by a number of steps without waiting for the
+ * queued moves. For CORE machines the steps go to both core steppers.
+ */
+void Stepper::shift_position(const AxisEnum axis, const int32_t &steps) {
+  CRITICAL_SECTION_START;
+  #if IS_CORE
+    if (axis == CORE_AXIS_1) {
+      count_position[CORE_AXIS_1] += steps;
+      count_position[CORE_AXIS_2] += CORESIGN(steps);
+    }
+    else if (axis == CORE_AXIS_2) {
+      count_position[CORE_AXIS_1] += steps;
+      count_position[CORE_AXIS_2] -= CORESIGN(steps);
+    }
+    else
+  #endif
+      count_position[axis] += steps;
+  CRITICAL_SECTION_END;
+}
+
 /**
  * Get a stepper's position in steps.
  */
@@ -1242,14 +2028,26 @@ void Stepper::quick_stop() {
   DISABLE_STEPPER_DRIVER_INTERRUPT();
   while (planner.blocks_queued()) planner.discard_current_block();
   current_block = NULL;
+  #if ENABLED(INPUT_SHAPING)
+    discard_shaping();
+  #endif
   ENABLE_STEPPER_DRIVER_INTERRUPT();
-  #if ENABLED(ULTRA_LCD)
-    planner.clear_block_buffer_runtime();
+  #if ENABLED(SEGMENT_MERGE)
+    planner.discard_merged_segment();
+  #endif
+  #if ENABLED(BLOCK_SYNC_EVENTS)
+    planner.discard_sync_events();
   #endif
+  planner.clear_block_buffer_runtime();
 }
 
 void Stepper::endstop_triggered(AxisEnum axis) {
 
+  #if ENABLED(INPUT_SHAPING)
+    // Stop X and Y where they are, so count_position is the shaped position
+    discard_shaping();
+  #endif
+
   #if IS_CORE
 
     endstops_trigsteps[axis] = 0.5f * (
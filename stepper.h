@@ -55,6 +55,8 @@ extern Stepper stepper;
 #define ENABLE_STEPPER_DRIVER_INTERRUPT()  SBI(TIMSK1, OCIE1A)
 #define DISABLE_STEPPER_DRIVER_INTERRUPT() CBI(TIMSK1, OCIE1A)
 
+#ifdef __AVR__
+
 // intRes = intIn1 * intIn2 >> 16
 // uses:
 // r26 to store 0
@@ -80,6 +82,14 @@ extern Stepper stepper;
                  "r26" \
                )
 
+#else
+
+// Portable equivalent for host builds: intRes = (charIn1 * intIn2 + 128) >> 8
+#define MultiU16X8toH16(intRes, charIn1, intIn2) \
+  intRes = ((uint32_t)(charIn1) * (uint32_t)(intIn2) + 128) >> 8
+
+#endif
+
 class Stepper {
 
   public:
@@ -103,6 +113,12 @@ class Stepper {
 
     static int16_t cleaning_buffer_counter;
 
+    #if ENABLED(INPUT_SHAPING)
+      static float shaping_frequency[2],         // M593 F (Hz), 0 for off
+                   shaping_zeta[2];              // M593 D
+      static uint32_t shaping_max_rate;          // Fastest X and Y step rate the shaping buffer can hold
+    #endif
+
   private:
 
     static uint8_t last_direction_bits;        // The next stepping-bits to be output
@@ -121,28 +137,99 @@ class Stepper {
     static long counter_X, counter_Y, counter_Z, counter_E;
     static volatile uint32_t step_events_completed; // The number of step events executed in the current block
 
+    #if HAS_STEP_ISR_SCHEDULER
+      static uint16_t nextMainISR;
+      #define _NEXT_ISR(T) nextMainISR = T
+    #else
+      #define _NEXT_ISR(T) OCR1A = T
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
 
-      static uint16_t nextMainISR, nextAdvanceISR, eISR_Rate;
-      #define _NEXT_ISR(T) nextMainISR = T
+      static uint16_t nextAdvanceISR;
       static volatile int e_steps[E_STEPPERS];
-      static int final_estep_rate;
-      static int current_estep_rate[E_STEPPERS]; // Actual extruder speed [steps/s]
       static int current_adv_steps[E_STEPPERS];  // The amount of current added esteps due to advance.
                                                  // i.e., the current amount of pressure applied
                                                  // to the spring (=filament).
-    #else // !LIN_ADVANCE
 
-      #define _NEXT_ISR(T) OCR1A = T
-
-    #endif // !LIN_ADVANCE
+      // Pressure profile of the last advance block, kept until the next one starts
+      static uint8_t LA_active_extruder;
+      static uint16_t LA_advance_speed,          // Timer interval between pressure steps
+                      LA_max_adv_steps,          // Pressure at the nominal speed
+                      LA_final_adv_steps;        // Pressure at the exit speed
+      static bool LA_decelerating;               // Set once the block starts to decelerate
+
+    #endif // LIN_ADVANCE
+
+    #if ENABLED(INPUT_SHAPING)
+
+      // X and Y steps of one main ISR, kept for the delayed impulses
+      typedef struct {
+        uint32_t time;                           // shaping_clock at the main ISR
+        int8_t steps[2];                         // X and Y steps, signed by direction
+      } shaping_event_t;
+
+      #define SHAPING_MOD(n) ((n) & (SHAPING_BUFFER_SIZE - 1))
+
+      static uint16_t nextShapingISR;
+      static uint32_t shaping_clock;             // Timer ticks up to the running ISR
+      static uint16_t shaping_min_interval;      // Timer ticks between main ISRs for the queue to hold the longest delay
+      static uint8_t shaping_axes;               // Bits of the axes with shaping on
+      static int16_t shaping_amplitude[2][SHAPING_IMPULSES]; // Impulse sizes in 1/256 step. Each axis adds up to 256.
+      static uint32_t shaping_delay[2][SHAPING_IMPULSES];    // Impulse delays in timer ticks
+      static shaping_event_t shaping_queue[SHAPING_BUFFER_SIZE];
+      static volatile uint8_t shaping_head,
+                              shaping_echo[2][SHAPING_IMPULSES - 1]; // Next event for each delayed impulse
+      static int8_t shaping_steps[2];            // Steps taken by the running main ISR
+      static int16_t shaping_sum[2];             // Impulses not yet stepped, in 1/256 step
+      static volatile int16_t shaping_pending[2]; // X and Y steps counted but not yet taken
+      static int8_t shaping_dir[2];              // X and Y directions last set for shaped steps, 0 if unknown
+
+    #endif // INPUT_SHAPING
 
     static long acceleration_time, deceleration_time;
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      static int32_t bezier_F,        // Rate at the start of the current S-curve phase
+                     bezier_D;        // Rate change over the current S-curve phase
+      static uint32_t bezier_AV;      // Inverse of the phase duration, scaled to 0xFFFFFFFF
+      static bool bezier_2nd_half;    // Set once the deceleration curve is initialized
+    #endif
     static uint8_t step_loops, step_loops_nominal;
 
+    #if MULTISTEPPING_LIMIT > 1
+      #ifdef MULTISTEP_ISR_TICKS
+        static constexpr uint8_t isr_ticks = MULTISTEP_ISR_TICKS;
+      #else
+        static uint8_t isr_ticks;   // Run time of the stepping ISR (timer ticks), quick to rise and slow to fall
+      #endif
+    #endif
+
     static uint16_t OCR1A_nominal,
                     acc_step_rate; // needed for deceleration start point
 
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      // A run of stepper ISRs at a constant rate, prepared in the main loop
+      typedef struct {
+        uint16_t interval,          // Timer ticks between ISRs
+                 step_rate;         // The step rate for this interval
+        uint8_t step_loops,         // Steps taken per ISR
+                isr_count;          // ISRs left to run at this rate
+      } step_segment_t;
+
+      static step_segment_t segment_buffer[STEP_SEGMENT_BUFFER_SIZE];
+      static volatile uint8_t segment_buffer_head,  // Written by prep_segments
+                              segment_buffer_tail,  // Written by the ISR
+                              segment_sync;         // Bumped whenever the ISR moves on without a segment
+
+      // The point in the current block where the next segment begins
+      static uint8_t prep_sync;
+      static uint32_t prep_step_events;
+      static long prep_acceleration_time, prep_deceleration_time;
+      static uint16_t prep_acc_step_rate;
+      static uint8_t prep_step_loops;
+    #endif
+
     static volatile long endstops_trigsteps[XYZ];
     static volatile long endstops_stepsTotal, endstops_stepsDone;
 
@@ -186,7 +273,25 @@ class Stepper {
 
     #if ENABLED(LIN_ADVANCE)
       static void advance_isr();
-      static void advance_isr_scheduler();
+      static void pulse_e_steps();
+    #endif
+
+    #if ENABLED(INPUT_SHAPING)
+      static void shaping_isr();
+      static void shape_steps();
+      static void pulse_shaped_steps();
+      static void discard_shaping();
+    #endif
+
+    #if HAS_STEP_ISR_SCHEDULER
+      static void isr_scheduler();
+    #endif
+
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+      //
+      // Prepare acceleration and deceleration segments for the ISR
+      //
+      static void prep_segments();
     #endif
 
     //
@@ -194,12 +299,19 @@ class Stepper {
     //
     static void synchronize();
 
+    //
+    // Block until the block with the given sequence number is executed,
+    // leaving any later blocks running. (See Planner::block_fence)
+    //
+    static void wait_for_block(const uint32_t sequence);
+
     //
     // Set the current position in steps
     //
     static void set_position(const long &a, const long &b, const long &c, const long &e);
     static void set_position(const AxisEnum &a, const long &v);
     static void set_e_position(const long &e);
+    static void shift_position(const AxisEnum axis, const int32_t &steps);
 
     //
     // Set direction bits for all steppers
@@ -216,6 +328,30 @@ class Stepper {
     //
     static void report_positions();
 
+    #if ENABLED(INPUT_SHAPING)
+      //
+      // Set up the impulses from the shaping frequency and damping.
+      // Waits for the moves and any delayed impulses to finish.
+      //
+      static void refresh_shaping();
+      static void set_shaping(const AxisEnum axis, const float &freq, const float &zeta);
+
+      //
+      // Get the X or Y stepper position, in steps, including only the impulses already stepped
+      //
+      static long shaped_stepper_position(const AxisEnum axis);
+
+      //
+      // Are any delayed impulses still to be stepped?
+      //
+      FORCE_INLINE static bool shaping_busy() {
+        for (uint8_t a = 0; a < 2; a++)
+          for (uint8_t i = 0; i < SHAPING_IMPULSES - 1; i++)
+            if (TEST(shaping_axes, a) && shaping_echo[a][i] != shaping_head) return true;
+        return false;
+      }
+    #endif
+
     //
     // Get the position (mm) of an axis based on stepper position(s)
     //
@@ -300,48 +436,155 @@ class Stepper {
       static void refresh_motor_power();
     #endif
 
-  private:
-
-    FORCE_INLINE static unsigned short calc_timer_interval(unsigned short step_rate) {
+    // Look up the timer interval for a step rate, within the range of the tables
+    FORCE_INLINE static unsigned short lookup_timer_interval(unsigned short step_rate) {
       unsigned short timer;
 
-      NOMORE(step_rate, MAX_STEP_FREQUENCY);
-
-      if (step_rate > 20000) { // If steprate > 20kHz >> step 4 times
-        step_rate >>= 2;
-        step_loops = 4;
-      }
-      else if (step_rate > 10000) { // If steprate > 10kHz >> step 2 times
-        step_rate >>= 1;
-        step_loops = 2;
-      }
-      else {
-        step_loops = 1;
-      }
-
-      NOLESS(step_rate, F_CPU / 500000);
-      step_rate -= F_CPU / 500000; // Correct for minimal speed
-      if (step_rate >= (8 * 256)) { // higher step rate
-        unsigned short table_address = (unsigned short)&speed_lookuptable_fast[(unsigned char)(step_rate >> 8)][0];
+      NOMORE(step_rate, SPEED_LOOKUPTABLE_MAX_RATE);
+      NOLESS(step_rate, SPEED_LOOKUPTABLE_MIN_RATE);
+      step_rate -= SPEED_LOOKUPTABLE_MIN_RATE; // Correct for minimal speed
+      if (step_rate >= (8 * (SPEED_LOOKUPTABLE_SLOW_SIZE))) { // higher step rate
+        const uint16_t * const table_address = speed_lookuptable_fast.row[(unsigned char)(step_rate >> 8)];
         unsigned char tmp_step_rate = (step_rate & 0x00FF);
-        unsigned short gain = (unsigned short)pgm_read_word_near(table_address + 2);
+        unsigned short gain = (unsigned short)pgm_read_word_near(table_address + 1);
         MultiU16X8toH16(timer, tmp_step_rate, gain);
         timer = (unsigned short)pgm_read_word_near(table_address) - timer;
       }
       else { // lower step rates
-        unsigned short table_address = (unsigned short)&speed_lookuptable_slow[0][0];
-        table_address += ((step_rate) >> 1) & 0xFFFC;
+        const uint16_t * const table_address = speed_lookuptable_slow.row[(step_rate) >> 3];
         timer = (unsigned short)pgm_read_word_near(table_address);
-        timer -= (((unsigned short)pgm_read_word_near(table_address + 2) * (unsigned char)(step_rate & 0x0007)) >> 3);
-      }
-      if (timer < 100) { // (20kHz - this should never happen)
-        timer = 100;
-        MYSERIAL.print(MSG_STEPPER_TOO_HIGH);
-        MYSERIAL.println(step_rate);
+        timer -= (((unsigned short)pgm_read_word_near(table_address + 1) * (unsigned char)(step_rate & 0x0007)) >> 3);
       }
       return timer;
     }
 
+    /**
+     * Get the timer interval for a step rate, and the number of steps to take
+     * per interrupt at that rate. The planner uses this to precompute a block's
+     * initial and nominal timer values.
+     *
+     * Take the fewest steps per interrupt (1, 2, 4 or 8) that keep the interrupts
+     * MULTISTEP_ISR_HEADROOM times the ISR run time apart, and no faster than
+     * MAX_ISR_FREQUENCY. 'loops' holds the current steps per interrupt. These only
+     * drop again with 25% to spare, so they don't flip back and forth around a limit.
+     */
+    FORCE_INLINE static unsigned short calc_timer_interval(unsigned short step_rate, uint8_t &loops) {
+
+      NOMORE(step_rate, MAX_STEP_FREQUENCY);
+
+      #if MULTISTEPPING_LIMIT > 1
+
+        uint16_t min_interval = (uint16_t)isr_ticks * (MULTISTEP_ISR_HEADROOM);
+        NOLESS(min_interval, (STEPPER_TIMER_RATE) / (MAX_ISR_FREQUENCY));
+        #if ENABLED(INPUT_SHAPING)
+          NOLESS(min_interval, shaping_min_interval); // One shaping queue entry per ISR
+        #endif
+
+        // The interval for 8 steps, close enough to choose the steps per interrupt
+        const uint16_t interval8 = lookup_timer_interval(step_rate >> 3);
+        #define _LOOPS_INTERVAL(N) uint16_t(((uint32_t)interval8 * (N)) >> 3)
+
+        uint8_t fewest = 1;
+        while (fewest < MULTISTEPPING_LIMIT && _LOOPS_INTERVAL(fewest) < min_interval) fewest <<= 1;
+
+        if (loops > fewest && loops <= MULTISTEPPING_LIMIT) {
+          const uint16_t drop_interval = min_interval + (min_interval >> 2);
+          while (loops > fewest && _LOOPS_INTERVAL(loops >> 1) >= drop_interval) loops >>= 1;
+        }
+        else
+          loops = fewest;
+
+        #undef _LOOPS_INTERVAL
+
+        switch (loops) {
+          case 8: return interval8;
+          case 4: step_rate >>= 2; break;
+          case 2: step_rate >>= 1; break;
+        }
+
+      #else
+
+        loops = 1;
+
+      #endif
+
+      return lookup_timer_interval(step_rate);
+    }
+
+  private:
+
+    FORCE_INLINE static unsigned short calc_timer_interval(const unsigned short step_rate) {
+      return calc_timer_interval(step_rate, step_loops);
+    }
+
+    #if MULTISTEPPING_LIMIT > 1
+
+      /**
+       * The interval to the next ISR, when the steps per ISR change after a burst
+       * of 'loops_done' steps. Each burst stands for the step times around its
+       * middle, so move the next one by half the change to keep the steps on time.
+       */
+      FORCE_INLINE static uint16_t loops_transition_interval(const uint16_t interval, const uint8_t loops_done) {
+        if (step_loops == loops_done) return interval;
+        uint16_t step_interval = interval;
+        for (uint8_t l = step_loops; l > 1; l >>= 1) step_interval >>= 1;
+        return ((uint32_t)step_interval * (loops_done + step_loops)) >> 1;
+      }
+
+    #endif
+
+    #if ENABLED(STEP_SEGMENT_BUFFER)
+
+      // Drop all prepared segments and make prep_segments start over from the ISR state
+      FORCE_INLINE static void discard_segments() {
+        segment_buffer_tail = segment_buffer_head;
+        ++segment_sync;
+      }
+
+      // Take the rate and interval for the next ISR from the segment buffer, if it has any
+      FORCE_INLINE static bool next_segment(uint16_t &step_rate, uint16_t &interval) {
+        if (segment_buffer_tail == segment_buffer_head) {
+          ++segment_sync; // The ISR calculates this step itself
+          return false;
+        }
+        step_segment_t &seg = segment_buffer[segment_buffer_tail];
+        step_rate = seg.step_rate;
+        interval = seg.interval;
+        step_loops = seg.step_loops;
+        if (!--seg.isr_count) segment_buffer_tail = (segment_buffer_tail + 1) & (STEP_SEGMENT_BUFFER_SIZE - 1);
+        return true;
+      }
+
+    #endif
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+
+      // Set up an S-curve phase from rate v0 to rate v1 over the period given by 'av'
+      FORCE_INLINE static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av) {
+        bezier_F = v0;
+        bezier_D = v1 - v0;
+        bezier_AV = av;
+      }
+
+      /**
+       * Evaluate the S-curve rate at 'curr_step' timer ticks into the current phase.
+       *
+       * The rate follows the quintic smoothstep v = v0 + (v1 - v0) * (10t^3 - 15t^4 + 6t^5)
+       * with zero acceleration and jerk at both ends. Time is normalized to 0 <= t < 1 in
+       * 13-bit fixed point so every intermediate product fits in 32 bits.
+       */
+      FORCE_INLINE static int32_t _eval_bezier_curve(const uint32_t curr_step) {
+        const int32_t t = (bezier_AV * curr_step) >> 19;
+        // Horner's method: s = t^3 * (10 + t * (6t - 15))
+        int32_t s = (((6 * t - (15L << 13)) * t) >> 13) + (10L << 13);
+        s = (s * t) >> 13;
+        s = (s * t) >> 13;
+        s = (s * t) >> 13;
+        return bezier_F + ((bezier_D * s) >> 13);
+      }
+
+    #endif // S_CURVE_ACCELERATION
+
     // Initialize the trapezoid generator from the current block.
     // Called whenever a new block begins.
     FORCE_INLINE static void trapezoid_generator_reset() {
@@ -355,18 +598,43 @@ class Stepper {
       }
 
       deceleration_time = 0;
-      // step_rate to timer interval
-      OCR1A_nominal = calc_timer_interval(current_block->nominal_rate);
-      // make a note of the number of step loops required at nominal speed
-      step_loops_nominal = step_loops;
+      // The planner already looked up the timer intervals and step loops
+      OCR1A_nominal = current_block->nominal_timer;
+      step_loops_nominal = current_block->nominal_step_loops;
       acc_step_rate = current_block->initial_rate;
-      acceleration_time = calc_timer_interval(acc_step_rate);
+      #if MULTISTEPPING_LIMIT > 1
+        // Keep the extra steps per ISR of the last block while they still suit the rate
+        if (step_loops > current_block->initial_step_loops)
+          acceleration_time = calc_timer_interval(acc_step_rate);
+        else
+      #endif
+        {
+          acceleration_time = current_block->initial_timer;
+          step_loops = current_block->initial_step_loops;
+        }
       _NEXT_ISR(acceleration_time);
 
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // Set up the S-curve for the acceleration phase
+        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
+        bezier_2nd_half = false;
+      #endif
+
+      #if ENABLED(STEP_SEGMENT_BUFFER)
+        // Segments from an aborted block may be left over
+        discard_segments();
+      #endif
+
       #if ENABLED(LIN_ADVANCE)
-        if (current_block->use_advance_lead) {
-          current_estep_rate[current_block->active_extruder] = ((unsigned long)acc_step_rate * current_block->abs_adv_steps_multiplier8) >> 17;
-          final_estep_rate = (current_block->nominal_rate * current_block->abs_adv_steps_multiplier8) >> 17;
+        // Hand the block's pressure profile to the advance ISR and start the ramp.
+        // Other blocks leave the pressure (and any release in progress) alone.
+        if (TEST(current_block->flag, BLOCK_BIT_USE_ADVANCE_LEAD)) {
+          LA_active_extruder = TOOL_E_INDEX;
+          LA_advance_speed = current_block->advance_speed;
+          LA_max_adv_steps = current_block->max_adv_steps;
+          LA_final_adv_steps = current_block->final_adv_steps;
+          LA_decelerating = false;
+          nextAdvanceISR = 0;
         }
       #endif
 
@@ -391,4 +659,8 @@ class Stepper {
 
 };
 
+#if ENABLED(INPUT_SHAPING)
+  void gcode_M593();
+#endif
+
 #endif // STEPPER_H
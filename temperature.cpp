@@ -26,7 +26,7 @@
 
 #include "Marlin.h"
 #include "temperature.h"
-#include "thermistortables.h"
+#include "thermistor_lookuptable.h"
 #include "ultralcd.h"
 #include "planner.h"
 #include "language.h"
@@ -43,16 +43,22 @@
   #include "endstops.h"
 #endif
 
+#if ENABLED(ISR_STATISTICS)
+  #include "isr_stats.h"
+#endif
+
 #if ENABLED(USE_WATCHDOG)
   #include "watchdog.h"
 #endif
 
+#if ENABLED(PID_HEATUP_MODEL)
+  #include "gcode.h"
+#endif
+
 #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
-  static void* heater_ttbl_map[2] = { (void*)HEATER_0_TEMPTABLE, (void*)HEATER_1_TEMPTABLE };
-  static uint8_t heater_ttbllen_map[2] = { HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN };
+  static const int16_t * const heater_lookuptable[2] = { HEATER_0_LOOKUPTABLE, HEATER_1_LOOKUPTABLE };
 #else
-  static void* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS((void*)HEATER_0_TEMPTABLE, (void*)HEATER_1_TEMPTABLE, (void*)HEATER_2_TEMPTABLE, (void*)HEATER_3_TEMPTABLE, (void*)HEATER_4_TEMPTABLE);
-  static uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(HEATER_0_TEMPTABLE_LEN, HEATER_1_TEMPTABLE_LEN, HEATER_2_TEMPTABLE_LEN, HEATER_3_TEMPTABLE_LEN, HEATER_4_TEMPTABLE_LEN);
+  static const int16_t * const heater_lookuptable[HOTENDS] = ARRAY_BY_HOTENDS(HEATER_0_LOOKUPTABLE, HEATER_1_LOOKUPTABLE, HEATER_2_LOOKUPTABLE, HEATER_3_LOOKUPTABLE, HEATER_4_LOOKUPTABLE);
 #endif
 
 Temperature thermalManager;
@@ -89,6 +95,10 @@ int16_t Temperature::current_temperature_raw[HOTENDS] = { 0 },
   float Temperature::bedKp, Temperature::bedKi, Temperature::bedKd;
 #endif
 
+#if ENABLED(PID_HEATUP_MODEL)
+  heater_model_t Temperature::heater_model[HOTENDS];
+#endif
+
 #if ENABLED(BABYSTEPPING)
   volatile int Temperature::babystepsTodo[XYZ] = { 0 };
 #endif
@@ -135,6 +145,22 @@ volatile bool Temperature::temp_meas_ready = false;
   bool Temperature::pid_reset[HOTENDS];
 #endif
 
+#if ENABLED(PID_HEATUP_MODEL)
+  HeatupPhase Temperature::heatup_phase[HOTENDS] = { HeatupOff };
+  uint8_t Temperature::heatup_power[HOTENDS] = { 0 };
+  millis_t Temperature::heatup_hold_ms[HOTENDS] = { 0 };
+#endif
+
+#if ENABLED(PID_FIXED_POINT)
+  #if ENABLED(PIDTEMP)
+    pid_fixed_t Temperature::pid_fixed[HOTENDS];
+  #endif
+  #if ENABLED(PIDTEMPBED)
+    pid_fixed_t Temperature::pid_fixed_bed;
+  #endif
+  bool Temperature::pid_fixed_paused = false;
+#endif
+
 #if ENABLED(PIDTEMPBED)
   float Temperature::temp_iState_bed = { 0 },
         Temperature::temp_dState_bed = { 0 },
@@ -211,13 +237,109 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
 
 #if HAS_PID_HEATING
 
+  #if ENABLED(PID_AUTOTUNE_MODEL)
+
+    /**
+     * Each time the autotune switches the heater, the power it switched to,
+     * the reading then, and the extreme reading that follows, once the
+     * sensor sees the switch. The first record is the start of the heat-up.
+     */
+    typedef struct {
+      millis_t ms,          // Time of the switch
+               extreme_ms;  // From the switch to the extreme
+      float temp,           // Reading at the switch
+            extreme;        // Lowest or highest reading after the switch
+      uint8_t power;        // Power from the switch on (0-255)
+    } autotune_switch_t;
+
+    // The start, the first cut, and an on and off for each relay cycle, then the last on
+    #define AUTOTUNE_MODEL_SWITCHES(C) (2 * (C) + 3)
+
+    /**
+     * The reading a heater model predicts at a given time. The heater starts
+     * from ambient and moves toward the temperature each power holds, and
+     * the sensor sees it as it was a dead time earlier.
+     */
+    static float autotune_model_temp(const heater_model_t &model, const autotune_switch_t sw[], const uint8_t count, const millis_t ms) {
+      const float t = (ms - sw[0].ms) * 0.001 - model.dead_time;
+      float temp = model.ambient;
+      for (uint8_t i = 0; i < count; i++) {
+        const float start = (sw[i].ms - sw[0].ms) * 0.001;
+        if (start >= t) break;
+        float end = i + 1 < count ? (sw[i + 1].ms - sw[0].ms) * 0.001 : t;
+        NOMORE(end, t);
+        const float hold = model.ambient + model.gain * sw[i].power;
+        temp = hold + (temp - hold) * exp((start - end) / model.time_constant);
+      }
+      return temp;
+    }
+
+    /**
+     * Fit a first-order model with dead time to the autotune switches.
+     *
+     * The dead time is the mean delay from a switch to the extreme it causes.
+     * Over whole relay cycles the heat put in is the heat lost to ambient,
+     * which gives the gain, once the change in stored heat is allowed for.
+     * The time constant is the one that takes the heat-up from ambient to
+     * the reading at the first cut. The stored heat depends on it, so the
+     * two are refined together.
+     *
+     * temp_sum is the sum of the readings above ambient over the relay
+     * cycles, in °C·s.
+     *
+     * Return the RMS difference between the model and the readings at each
+     * switch and extreme, or a negative value if no model fits.
+     */
+    static float fit_autotune_model(heater_model_t &model, const autotune_switch_t sw[], const uint8_t count, const float temp_sum) {
+      model.ambient = sw[0].temp;
+
+      float dead_time = 0;
+      for (uint8_t i = 1; i < count - 1; i++) dead_time += sw[i].extreme_ms;
+      model.dead_time = dead_time * 0.001 / (count - 2);
+
+      // The readings lag the power, so move the power's window back by the dead time
+      float power_sum = 0;
+      for (uint8_t i = 2; i < count - 1; i++) power_sum += sw[i].power * ((sw[i + 1].ms - sw[i].ms) * 0.001);
+      power_sum -= model.dead_time * (sw[count - 2].power - sw[1].power);
+
+      const float heatup_time = (sw[1].ms - sw[0].ms) * 0.001 - model.dead_time,
+                  stored_temp = sw[count - 1].temp - sw[2].temp;
+      if (power_sum <= 0 || heatup_time <= 0) return -1;
+
+      model.gain = temp_sum / power_sum;
+      for (uint8_t i = 4; i--;) {
+        const float rise = (sw[1].temp - model.ambient) / (model.gain * sw[0].power);
+        if (!WITHIN(rise, 0.01, 0.99)) return -1;
+        model.time_constant = heatup_time / -log(1.0 - rise);
+        model.gain = (temp_sum + model.time_constant * stored_temp) / power_sum;
+      }
+      if (model.gain <= 0 || model.dead_time <= 0) return -1;
+
+      float error = 0;
+      for (uint8_t i = 1; i < count; i++) {
+        error += sq(sw[i].temp - autotune_model_temp(model, sw, count, sw[i].ms));
+        if (i < count - 1)
+          error += sq(sw[i].extreme - autotune_model_temp(model, sw, count, sw[i].ms + sw[i].extreme_ms));
+      }
+      return SQRT(error / (2 * count - 3));
+    }
+
+  #endif // PID_AUTOTUNE_MODEL
+
   /**
    * PID Autotuning (M303)
    *
    * Alternately heat and cool the nozzle, observing its behavior to
    * determine the best PID values to achieve a stable temperature.
+   *
+   * With fit_model, stop after the heat-up and one or two cycles, and get
+   * the PID values from a model fitted to them.
    */
-  void Temperature::PID_autotune(const float &target, const int8_t hotend, const int8_t ncycles, const bool set_result/*=false*/) {
+  void Temperature::PID_autotune(const float &target, const int8_t hotend, const int8_t ncycles, const bool set_result/*=false*/
+    #if ENABLED(PID_AUTOTUNE_MODEL)
+      , const bool fit_model/*=false*/
+    #endif
+  ) {
     float current = 0.0;
     int cycles = 0;
     bool heating = true;
@@ -230,6 +352,33 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
           workKp = 0, workKi = 0, workKd = 0,
           max = 0, min = 10000;
 
+    #if ENABLED(PID_HEATUP_MODEL)
+      // The first heat-up at full power, and the peak after it, give the model
+      constexpr uint8_t model_heat_power = ((PID_MAX) >> 1) << 1;
+      float model_start = 0, model_prev = 0, model_slope = 0,
+            cutoff_temp = 0, cutoff_slope = 0, peak_temp = 0, peak_time = 0;
+      millis_t model_prev_ms = 0;
+    #endif
+
+    #if ENABLED(PID_AUTOTUNE_MODEL)
+      const int8_t tune_cycles = fit_model ? constrain(ncycles, 1, 2) : ncycles;
+      autotune_switch_t sw[AUTOTUNE_MODEL_SWITCHES(2)];
+      uint8_t sw_count = 0;
+      float temp_sum = 0;
+      millis_t temp_sum_ms = 0, extreme_first_ms = 0;
+      #define _RECORD_SWITCH(P) do{ \
+        if (fit_model && sw_count < COUNT(sw)) { \
+          autotune_switch_t &s = sw[sw_count++]; \
+          s.ms = temp_sum_ms = extreme_first_ms = ms; \
+          s.extreme_ms = 0; \
+          s.temp = s.extreme = current; \
+          s.power = ((P) >> 1) << 1; \
+        } }while(0)
+    #else
+      const int8_t tune_cycles = ncycles;
+      #define _RECORD_SWITCH(P) NOOP
+    #endif
+
     #define HAS_TP_BED (ENABLED(THERMAL_PROTECTION_BED) && ENABLED(PIDTEMPBED))
     #if HAS_TP_BED && ENABLED(THERMAL_PROTECTION_HOTENDS) && ENABLED(PIDTEMP)
       #define TV(B,H) (hotend < 0 ? (B) : (H))
@@ -272,6 +421,10 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
 
     disable_all_heaters(); // switch off all heaters.
 
+    #if ENABLED(PID_FIXED_POINT)
+      pid_fixed_paused = true; // The ISR mustn't drive the heaters while tuning
+    #endif
+
     #if HAS_PID_FOR_BOTH
       if (hotend < 0)
         soft_pwm_amount_bed = bias = d = (MAX_BED_POWER) >> 1;
@@ -306,6 +459,48 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
         NOLESS(max, current);
         NOMORE(min, current);
 
+        #if ENABLED(PID_HEATUP_MODEL)
+          // Track the rate of the first heat-up, one second at a time,
+          // then the peak after the power is first cut
+          if (!cycles && heating) {
+            if (!model_prev_ms) {
+              model_start = model_prev = current;
+              model_prev_ms = ms;
+            }
+            else if (ELAPSED(ms, model_prev_ms + 1000UL)) {
+              model_slope = (current - model_prev) * 1000.0 / (ms - model_prev_ms);
+              model_prev = current;
+              model_prev_ms = ms;
+            }
+          }
+          else if (!cycles && current > peak_temp) {
+            peak_temp = current;
+            peak_time = (ms - t1) * 0.001; // Since the cut
+          }
+        #endif
+
+        #if ENABLED(PID_AUTOTUNE_MODEL)
+          if (fit_model) {
+            if (!sw_count) _RECORD_SWITCH(bias + d);
+            // Find the extreme reading since the last switch, and the middle of its plateau
+            autotune_switch_t &s = sw[sw_count - 1];
+            if (sw_count > 1) {
+              if (heating ? current < s.extreme : current > s.extreme) {
+                s.extreme = current;
+                extreme_first_ms = ms;
+                s.extreme_ms = ms - s.ms;
+              }
+              else if (current == s.extreme)
+                s.extreme_ms = extreme_first_ms + (ms - extreme_first_ms) / 2 - s.ms;
+            }
+            // Sum the readings above ambient over the relay cycles
+            if (cycles > 0) {
+              temp_sum += (current - sw[0].temp) * ((ms - temp_sum_ms) * 0.001);
+              temp_sum_ms = ms;
+            }
+          }
+        #endif
+
         #if HAS_AUTO_FAN
           if (ELAPSED(ms, next_auto_fan_check_ms)) {
             checkExtruderAutoFans();
@@ -316,6 +511,12 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
         if (heating && current > target) {
           if (ELAPSED(ms, t2 + 5000UL)) {
             heating = false;
+            #if ENABLED(PID_HEATUP_MODEL)
+              if (!cycles) {
+                cutoff_temp = peak_temp = current;
+                cutoff_slope = model_slope;
+              }
+            #endif
             #if HAS_PID_FOR_BOTH
               if (hotend < 0)
                 soft_pwm_amount_bed = (bias - d) >> 1;
@@ -326,6 +527,7 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
             #elif ENABLED(PIDTEMPBED)
               soft_pwm_amount_bed = (bias - d) >> 1;
             #endif
+            _RECORD_SWITCH(bias - d);
             t1 = ms;
             t_high = t1 - t2;
             max = target;
@@ -395,6 +597,7 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
             #else
               soft_pwm_amount_bed = (bias + d) >> 1;
             #endif
+            _RECORD_SWITCH(bias + d);
             cycles++;
             min = target;
           }
@@ -438,7 +641,32 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
         break;
       }
 
-      if (cycles > ncycles) {
+      if (cycles > tune_cycles) {
+        #if ENABLED(PID_AUTOTUNE_MODEL)
+          heater_model_t model;
+          if (fit_model) {
+            const float error = fit_autotune_model(model, sw, sw_count, temp_sum);
+            if (error < 0) {
+              SERIAL_PROTOCOLLNPGM(MSG_PID_BAD_MODEL);
+              break;
+            }
+            SERIAL_PROTOCOLPAIR(MSG_MODEL_K, model.gain);
+            SERIAL_PROTOCOLPAIR(MSG_MODEL_T, model.time_constant);
+            SERIAL_PROTOCOLPAIR(MSG_MODEL_L, model.dead_time);
+            SERIAL_PROTOCOLLNPAIR(MSG_MODEL_ERROR, error);
+
+            // AMIGO rules for a first-order process with dead time
+            const float K = model.gain, T = model.time_constant, L = model.dead_time;
+            workKp = (0.2 + 0.45 * T / L) / K;
+            workKi = workKp * (L + 0.1 * T) / ((0.4 * L + 0.8 * T) * L);
+            workKd = workKp * 0.5 * L * T / (0.3 * L + T);
+            SERIAL_PROTOCOLPGM(MSG_AMIGO_PID);
+            SERIAL_PROTOCOLPAIR(MSG_KP, workKp);
+            SERIAL_PROTOCOLPAIR(MSG_KI, workKi);
+            SERIAL_PROTOCOLLNPAIR(MSG_KD, workKd);
+          }
+        #endif
+
         SERIAL_PROTOCOLLNPGM(MSG_PID_AUTOTUNE_FINISHED);
 
         #if HAS_PID_FOR_BOTH
@@ -456,11 +684,58 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
           SERIAL_PROTOCOLPAIR("#define  DEFAULT_bedKd ", workKd); SERIAL_EOL();
         #endif
 
+        #if ENABLED(PID_HEATUP_MODEL)
+          /**
+           * Fit a first-order model whose sensor lags by the dead time.
+           *
+           * The bias that centered the oscillation is the power that holds
+           * the target. When the power was first cut, the heater itself was
+           * a dead time of rising ahead of the sensor. It then cooled until
+           * the sensor caught up with it at the peak. That gives the heater
+           * temperature at the cut, and from it the time constant of the
+           * rise at full power, refined a few times since the cooling rate
+           * depends on the time constant too. A model-fit autotune already
+           * has a better model.
+           */
+          #if ENABLED(PID_AUTOTUNE_MODEL)
+            if (!fit_model)
+          #else
+            heater_model_t model;
+          #endif
+          {
+            model.ambient = model_start;
+            model.gain = (target - model_start) / bias;
+            model.time_constant = model.dead_time = 0;
+            if (cutoff_slope > 0) {
+              float heater_temp = cutoff_temp;
+              for (uint8_t i = 4; i--;) {
+                model.time_constant = (model.gain * model_heat_power + model_start - heater_temp) / cutoff_slope;
+                if (model.time_constant <= 0) break;
+                heater_temp = peak_temp + (peak_temp - model_start) * peak_time / model.time_constant;
+              }
+              model.dead_time = (heater_temp - cutoff_temp) / cutoff_slope;
+            }
+          }
+          const bool model_ok = hotend >= 0 && model.gain > 0 && model.time_constant > 0 && model.dead_time >= 0;
+          if (model_ok) {
+            SERIAL_PROTOCOLPAIR("#define  DEFAULT_MODEL_GAIN ", model.gain); SERIAL_EOL();
+            SERIAL_PROTOCOLPAIR("#define  DEFAULT_MODEL_TIME_CONSTANT ", model.time_constant); SERIAL_EOL();
+            SERIAL_PROTOCOLPAIR("#define  DEFAULT_MODEL_DEAD_TIME ", model.dead_time); SERIAL_EOL();
+            SERIAL_PROTOCOLPAIR("#define  DEFAULT_MODEL_AMBIENT ", model.ambient); SERIAL_EOL();
+          }
+        #endif
+
+        #if ENABLED(PID_FIXED_POINT)
+          #define _UPDATE_BED_PID() updatePID()
+        #else
+          #define _UPDATE_BED_PID() NOOP
+        #endif
+
         #define _SET_BED_PID() do { \
           bedKp = workKp; \
           bedKi = scalePID_i(workKi); \
           bedKd = scalePID_d(workKd); \
-          }while(0)
+          _UPDATE_BED_PID(); }while(0)
 
         #define _SET_EXTRUDER_PID() do { \
           PID_PARAM(Kp, hotend) = workKp; \
@@ -480,12 +755,21 @@ uint8_t Temperature::soft_pwm_amount[HOTENDS],
           #else
             _SET_BED_PID();
           #endif
+          #if ENABLED(PID_HEATUP_MODEL)
+            if (model_ok) heater_model[hotend] = model;
+          #endif
         }
+        #if ENABLED(PID_FIXED_POINT)
+          pid_fixed_paused = false;
+        #endif
         return;
       }
       lcd_update();
     }
     disable_all_heaters();
+    #if ENABLED(PID_FIXED_POINT)
+      pid_fixed_paused = false;
+    #endif
   }
 
 #endif // HAS_PID_HEATING
@@ -596,6 +880,13 @@ float Temperature::get_pid_output(const int8_t e) {
         }
         else
       #endif
+      #if ENABLED(PID_HEATUP_MODEL)
+        if (heatup_phase[HOTEND_INDEX] != HeatupOff) {
+          pid_output = heatup_phase[HOTEND_INDEX] == HeatupFullPower ? BANG_MAX : heatup_power[HOTEND_INDEX];
+          pid_reset[HOTEND_INDEX] = true;
+        }
+        else
+      #endif
       if (pid_error[HOTEND_INDEX] > PID_FUNCTIONAL_RANGE) {
         pid_output = BANG_MAX;
         pid_reset[HOTEND_INDEX] = true;
@@ -611,6 +902,10 @@ float Temperature::get_pid_output(const int8_t e) {
       else {
         if (pid_reset[HOTEND_INDEX]) {
           temp_iState[HOTEND_INDEX] = 0.0;
+          #if ENABLED(PID_HEATUP_MODEL)
+            // Take over at the power that holds the target
+            if (PID_PARAM(Ki, HOTEND_INDEX) > 0) temp_iState[HOTEND_INDEX] = heatup_power[HOTEND_INDEX] / PID_PARAM(Ki, HOTEND_INDEX);
+          #endif
           pid_reset[HOTEND_INDEX] = false;
         }
         pTerm[HOTEND_INDEX] = PID_PARAM(Kp, HOTEND_INDEX) * pid_error[HOTEND_INDEX];
@@ -719,6 +1014,281 @@ float Temperature::get_pid_output(const int8_t e) {
   }
 #endif // PIDTEMPBED
 
+#if ENABLED(PID_HEATUP_MODEL)
+
+  /**
+   * Step a hotend through a model-based heat-up.
+   *
+   * A heat-up starts when the hotend is more than PID_FUNCTIONAL_RANGE
+   * below its target. It runs at full power while the heater, a dead
+   * time ahead of the sensor, is still below the target. Then it holds
+   * the power the target needs, so the heater stays put while the sensor
+   * catches up. After three dead times, or once within HEATUP_WINDOW, the
+   * PID takes over, starting from that same power.
+   */
+  #define HEATUP_WINDOW 0.5 // °C
+
+  void Temperature::update_heatup_model(const uint8_t e) {
+    const heater_model_t &model = heater_model[e];
+    const float error = target_temperature[e] - current_temperature[e];
+
+    heatup_power[e] = model.gain > 0 ? constrain((target_temperature[e] - model.ambient) / model.gain, 0, PID_MAX) : 0;
+
+    if (model.gain <= 0 || model.time_constant <= 0 || !target_temperature[e] || error < -(PID_FUNCTIONAL_RANGE)) {
+      heatup_phase[e] = HeatupOff;
+      return;
+    }
+
+    if (heatup_phase[e] == HeatupOff && error > PID_FUNCTIONAL_RANGE)
+      heatup_phase[e] = HeatupFullPower;
+
+    if (heatup_phase[e] == HeatupFullPower) {
+      // Rate of rise at full power, with the heater a dead time ahead of the sensor
+      const float rate = (model.gain * (BANG_MAX) + model.ambient - current_temperature[e]) / (model.time_constant + model.dead_time);
+      if (current_temperature[e] + model.dead_time * rate >= target_temperature[e]) {
+        heatup_phase[e] = HeatupHold;
+        heatup_hold_ms[e] = millis() + millis_t(model.dead_time * 3000);
+      }
+    }
+
+    if (heatup_phase[e] == HeatupHold && (error <= HEATUP_WINDOW || ELAPSED(millis(), heatup_hold_ms[e])))
+      heatup_phase[e] = HeatupOff;
+  }
+
+  /**
+   * M306: Set or report the heat-up model of a hotend
+   *
+   *   E  Hotend index. Default 0.
+   *   K  °C above ambient held by each step of power (0-255). 0 turns the model off.
+   *   T  Time constant in seconds
+   *   L  Dead time in seconds
+   *   A  Ambient temperature in °C
+   *
+   * With no K, T, L, or A, report the model.
+   */
+  void gcode_M306() {
+    const uint8_t e = parser.byteval('E');
+    if (e >= HOTENDS) {
+      SERIAL_ERROR_START();
+      SERIAL_ERRORLNPGM(MSG_INVALID_EXTRUDER);
+      return;
+    }
+
+    heater_model_t &model = thermalManager.heater_model[e];
+    if (!parser.seen('K') && !parser.seen('T') && !parser.seen('L') && !parser.seen('A')) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPAIR("M306 E", e);
+      SERIAL_ECHOPAIR(" K", model.gain);
+      SERIAL_ECHOPAIR(" T", model.time_constant);
+      SERIAL_ECHOPAIR(" L", model.dead_time);
+      SERIAL_ECHOLNPAIR(" A", model.ambient);
+      return;
+    }
+
+    const float gain = parser.floatval('K', model.gain),
+                time_constant = parser.floatval('T', model.time_constant),
+                dead_time = parser.floatval('L', model.dead_time);
+    if (gain < 0 || time_constant < 0 || dead_time < 0) {
+      SERIAL_ERROR_START();
+      SERIAL_ERRORLNPGM("?K, T, and L can't be negative.");
+      return;
+    }
+    model.gain = gain;
+    model.time_constant = time_constant;
+    model.dead_time = dead_time;
+    model.ambient = parser.floatval('A', model.ambient);
+  }
+
+#endif // PID_HEATUP_MODEL
+
+#if ENABLED(PID_FIXED_POINT)
+
+  #define PID_FIXED_ONE 65536L // One PWM step
+
+  /**
+   * Update the fixed-point PID loops when PID values change
+   */
+  void Temperature::updatePID() {
+    #if ENABLED(PIDTEMP)
+      #if ENABLED(PID_EXTRUSION_SCALING)
+        last_e_position = 0;
+      #endif
+      HOTEND_LOOP()
+        set_pid_fixed_gains(pid_fixed[e], PID_PARAM(Kp, e), PID_PARAM(Ki, e), PID_PARAM(Kd, e), PID_MAX
+          #if ENABLED(PID_EXTRUSION_SCALING)
+            , PID_PARAM(Kc, e) * planner.steps_to_mm[E_AXIS]
+          #endif
+        );
+    #endif
+    #if ENABLED(PIDTEMPBED)
+      set_pid_fixed_gains(pid_fixed_bed, bedKp, bedKi, bedKd, MAX_BED_POWER
+        #if ENABLED(PID_EXTRUSION_SCALING)
+          , 0
+        #endif
+      );
+    #endif
+  }
+
+  /**
+   * Convert gains, with Ki and Kd already scaled by PID_dT, for a fixed-point loop.
+   *
+   * The limits keep |pTerm| and each step of dTerm below 2^29 and 2^24
+   * PWM units, and each step of iTerm within the full output range, so
+   * the sum of the terms can't overflow. Errors big enough to reach a
+   * limit saturate the output anyway.
+   */
+  void Temperature::set_pid_fixed_gains(pid_fixed_t &pid, const float &Kp, const float &Ki, const float &Kd, const uint8_t max_power
+    #if ENABLED(PID_EXTRUSION_SCALING)
+      , const float &Kc
+    #endif
+  ) {
+    constexpr float per_unit = float(PID_FIXED_ONE) / (THERMISTOR_LOOKUPTABLE_SCALE);
+    const float kp = max(Kp * per_unit, 1.0f),
+                ki = max(Ki * per_unit, 1.0f),
+                kd = max(Kd * ((256 - (PID_K1_FIXED)) / 256.0f) * per_unit, 1.0f),
+                full = float(max_power) * PID_FIXED_ONE;
+    const int16_t error_limit = min(min(float(1L << 29) / kp, full / ki), 32767.0f),
+                  delta_limit = min(float(1L << 24) / kd, 32767.0f);
+    #if ENABLED(PID_EXTRUSION_SCALING)
+      const float kc = max(Kc * PID_FIXED_ONE, 1.0f);
+      const int32_t steps_limit = float(1L << 29) / kc;
+    #endif
+
+    CRITICAL_SECTION_START;
+    pid.Kp = Kp * per_unit;
+    pid.Ki = Ki * per_unit;
+    pid.Kd = Kd * ((256 - (PID_K1_FIXED)) / 256.0f) * per_unit;
+    pid.error_limit = error_limit;
+    pid.delta_limit = delta_limit;
+    #if ENABLED(PID_EXTRUSION_SCALING)
+      pid.Kc = Kc * PID_FIXED_ONE;
+      pid.steps_limit = steps_limit;
+    #endif
+    CRITICAL_SECTION_END;
+  }
+
+  // Feed a new temperature into the smoothed derivative term
+  FORCE_INLINE static void pid_fixed_derivative(pid_fixed_t &pid, const int16_t temp) {
+    const int16_t delta = constrain(temp - pid.last_temp, -pid.delta_limit, pid.delta_limit);
+    pid.last_temp = temp;
+    pid.dTerm = (pid.dTerm >> 8) * (PID_K1_FIXED) + pid.Kd * delta;
+  }
+
+  // The PID output for an error in 1/16 °C, from 0 to max_power
+  static uint8_t pid_fixed_output(pid_fixed_t &pid, const int16_t error, const uint8_t max_power) {
+    const int16_t err = constrain(error, -pid.error_limit, pid.error_limit);
+    const int32_t full = int32_t(max_power) * PID_FIXED_ONE,
+                  iTerm = pid.iTerm + pid.Ki * err;
+    pid.pTerm = pid.Kp * err;
+    const int32_t output = pid.pTerm + iTerm - pid.dTerm
+      #if ENABLED(PID_EXTRUSION_SCALING)
+        + pid.cTerm
+      #endif
+    ;
+    // Conditional integration: don't wind up against a saturated output
+    if (!(output > full && err > 0) && !(output < 0 && err < 0))
+      pid.iTerm = constrain(iTerm, -full, full);
+    return output <= 0 ? 0 : output >= full ? max_power : uint8_t((output + PID_FIXED_ONE / 2) / PID_FIXED_ONE);
+  }
+
+  /**
+   * Run the PID loops on the latest raw readings and set the heater PWM.
+   * Called from the temperature ISR each time the sensors have all been
+   * read OVERSAMPLENR times, i.e., every PID_dT.
+   */
+  void Temperature::update_pid_fixed() {
+    if (pid_fixed_paused) return;
+
+    #if ENABLED(PIDTEMP)
+      HOTEND_LOOP() {
+        pid_fixed_t &pid = pid_fixed[e];
+        const int16_t temp = thermistor_lookuptable::lookup_units(heater_lookuptable[e], raw_temp_value[e]);
+        uint8_t output;
+
+        pid_fixed_derivative(pid, temp);
+
+        #if DISABLED(PID_OPENLOOP)
+          const int16_t error = target_temperature[e] * (THERMISTOR_LOOKUPTABLE_SCALE) - temp;
+          // Outside the PID range keep iTerm where the PID should take over
+          #if ENABLED(PID_HEATUP_MODEL)
+            const int32_t hold_iTerm = int32_t(heatup_power[e]) * PID_FIXED_ONE;
+          #else
+            constexpr int32_t hold_iTerm = 0;
+          #endif
+          #if HEATER_IDLE_HANDLER
+            if (heater_idle_timeout_exceeded[e]) {
+              output = 0;
+              pid.iTerm = 0;
+            }
+            else
+          #endif
+          #if ENABLED(PID_HEATUP_MODEL)
+            if (heatup_phase[e] != HeatupOff) {
+              output = heatup_phase[e] == HeatupFullPower ? BANG_MAX : heatup_power[e];
+              pid.iTerm = hold_iTerm;
+            }
+            else
+          #endif
+          if (error > (PID_FUNCTIONAL_RANGE) * (THERMISTOR_LOOKUPTABLE_SCALE)) {
+            output = BANG_MAX;
+            pid.iTerm = hold_iTerm;
+          }
+          else if (error < -(PID_FUNCTIONAL_RANGE) * (THERMISTOR_LOOKUPTABLE_SCALE) || target_temperature[e] == 0) {
+            output = 0;
+            pid.iTerm = hold_iTerm;
+          }
+          else {
+            #if ENABLED(PID_EXTRUSION_SCALING)
+              pid.cTerm = 0;
+              #if HOTENDS > 1
+                if (e == active_extruder)
+              #endif
+              {
+                const long e_position = stepper.position(E_AXIS);
+                if (e_position > last_e_position) {
+                  lpq[lpq_ptr] = e_position - last_e_position;
+                  last_e_position = e_position;
+                }
+                else
+                  lpq[lpq_ptr] = 0;
+                if (++lpq_ptr >= lpq_len) lpq_ptr = 0;
+                pid.cTerm = pid.Kc * min(lpq[lpq_ptr], long(pid.steps_limit));
+              }
+            #endif
+            output = pid_fixed_output(pid, error, PID_MAX);
+          }
+        #else
+          output = constrain(target_temperature[e], 0, PID_MAX);
+        #endif // PID_OPENLOOP
+
+        soft_pwm_amount[e] = (temp > int32_t(minttemp[e]) * (THERMISTOR_LOOKUPTABLE_SCALE) || is_preheating(e))
+                             && temp < int32_t(maxttemp[e]) * (THERMISTOR_LOOKUPTABLE_SCALE) ? output >> 1 : 0;
+      }
+    #endif // PIDTEMP
+
+    #if ENABLED(PIDTEMPBED)
+      const int16_t temp = thermistor_lookuptable::lookup_units(BED_LOOKUPTABLE, raw_temp_bed_value);
+      uint8_t output;
+
+      pid_fixed_derivative(pid_fixed_bed, temp);
+
+      #if HEATER_IDLE_HANDLER
+        if (bed_idle_timeout_exceeded)
+          output = 0;
+        else
+      #endif
+      #if DISABLED(PID_OPENLOOP)
+        output = pid_fixed_output(pid_fixed_bed, target_temperature_bed * (THERMISTOR_LOOKUPTABLE_SCALE) - temp, MAX_BED_POWER);
+      #else
+        output = constrain(target_temperature_bed, 0, MAX_BED_POWER);
+      #endif
+
+      soft_pwm_amount_bed = WITHIN(temp, (BED_MINTEMP) * (THERMISTOR_LOOKUPTABLE_SCALE), (BED_MAXTEMP) * (THERMISTOR_LOOKUPTABLE_SCALE)) ? output >> 1 : 0;
+    #endif // PIDTEMPBED
+  }
+
+#endif // PID_FIXED_POINT
+
 /**
  * Manage heating activities for extruder hot-ends and a heated bed
  *  - Acquire updated temperature readings
@@ -755,7 +1325,27 @@ void Temperature::manage_heater() {
       thermal_runaway_protection(&thermal_runaway_state_machine[e], &thermal_runaway_timer[e], current_temperature[e], target_temperature[e], e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
     #endif
 
-    soft_pwm_amount[e] = (current_temperature[e] > minttemp[e] || is_preheating(e)) && current_temperature[e] < maxttemp[e] ? (int)get_pid_output(e) >> 1 : 0;
+    #if ENABLED(PID_HEATUP_MODEL)
+      update_heatup_model(e);
+    #endif
+
+    #if ENABLED(PIDTEMP) && ENABLED(PID_FIXED_POINT)
+      #if ENABLED(PID_DEBUG)
+        SERIAL_ECHO_START();
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG, e);
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_INPUT, current_temperature[e]);
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_OUTPUT, soft_pwm_amount[e] << 1);
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_PTERM, pid_fixed[e].pTerm * (1.0 / PID_FIXED_ONE));
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_ITERM, pid_fixed[e].iTerm * (1.0 / PID_FIXED_ONE));
+        SERIAL_ECHOPAIR(MSG_PID_DEBUG_DTERM, pid_fixed[e].dTerm * (1.0 / PID_FIXED_ONE));
+        #if ENABLED(PID_EXTRUSION_SCALING)
+          SERIAL_ECHOPAIR(MSG_PID_DEBUG_CTERM, pid_fixed[e].cTerm * (1.0 / PID_FIXED_ONE));
+        #endif
+        SERIAL_EOL();
+      #endif
+    #else
+      soft_pwm_amount[e] = (current_temperature[e] > minttemp[e] || is_preheating(e)) && current_temperature[e] < maxttemp[e] ? (int)get_pid_output(e) >> 1 : 0;
+    #endif
 
     #if WATCH_HOTENDS
       // Make sure temperature is increasing
@@ -831,7 +1421,9 @@ void Temperature::manage_heater() {
       else
     #endif
     {
-      #if ENABLED(PIDTEMPBED)
+      #if ENABLED(PIDTEMPBED) && ENABLED(PID_FIXED_POINT)
+        // Set by update_pid_fixed() in the temperature ISR
+      #elif ENABLED(PIDTEMPBED)
         soft_pwm_amount_bed = WITHIN(current_temperature_bed, BED_MINTEMP, BED_MAXTEMP) ? (int)get_pid_output_bed() >> 1 : 0;
       #else
         // Check if temperature is within the correct band
@@ -854,8 +1446,6 @@ void Temperature::manage_heater() {
   #endif // HAS_TEMP_BED
 }
 
-#define PGM_RD_W(x)   (short)pgm_read_word(&x)
-
 // Derived from RepRap FiveD extruder::getTemperature()
 // For hot end temperature measurement.
 float Temperature::analog2temp(const int raw, const uint8_t e) {
@@ -876,26 +1466,9 @@ float Temperature::analog2temp(const int raw, const uint8_t e) {
     if (e == 0) return 0.25 * raw;
   #endif
 
-  if (heater_ttbl_map[e] != NULL) {
-    float celsius = 0;
-    uint8_t i;
-    short(*tt)[][2] = (short(*)[][2])(heater_ttbl_map[e]);
-
-    for (i = 1; i < heater_ttbllen_map[e]; i++) {
-      if (PGM_RD_W((*tt)[i][0]) > raw) {
-        celsius = PGM_RD_W((*tt)[i - 1][1]) +
-                  (raw - PGM_RD_W((*tt)[i - 1][0])) *
-                  (float)(PGM_RD_W((*tt)[i][1]) - PGM_RD_W((*tt)[i - 1][1])) /
-                  (float)(PGM_RD_W((*tt)[i][0]) - PGM_RD_W((*tt)[i - 1][0]));
-        break;
-      }
-    }
-
-    // Overflow: Set to last value in the table
-    if (i == heater_ttbllen_map[e]) celsius = PGM_RD_W((*tt)[i - 1][1]);
+  if (heater_lookuptable[e] != NULL)
+    return thermistor_lookuptable::lookup(heater_lookuptable[e], raw);
 
-    return celsius;
-  }
   return ((raw * ((5.0 * 100.0) / 1024.0) / OVERSAMPLENR) * (TEMP_SENSOR_AD595_GAIN)) + TEMP_SENSOR_AD595_OFFSET;
 }
 
@@ -904,23 +1477,8 @@ float Temperature::analog2temp(const int raw, const uint8_t e) {
   // For bed temperature measurement.
   float Temperature::analog2tempBed(const int raw) {
     #if ENABLED(BED_USES_THERMISTOR)
-      float celsius = 0;
-      byte i;
-
-      for (i = 1; i < BEDTEMPTABLE_LEN; i++) {
-        if (PGM_RD_W(BEDTEMPTABLE[i][0]) > raw) {
-          celsius  = PGM_RD_W(BEDTEMPTABLE[i - 1][1]) +
-                     (raw - PGM_RD_W(BEDTEMPTABLE[i - 1][0])) *
-                     (float)(PGM_RD_W(BEDTEMPTABLE[i][1]) - PGM_RD_W(BEDTEMPTABLE[i - 1][1])) /
-                     (float)(PGM_RD_W(BEDTEMPTABLE[i][0]) - PGM_RD_W(BEDTEMPTABLE[i - 1][0]));
-          break;
-        }
-      }
-
-      // Overflow: Set to last value in the table
-      if (i == BEDTEMPTABLE_LEN) celsius = PGM_RD_W(BEDTEMPTABLE[i - 1][1]);
 
-      return celsius;
+      return thermistor_lookuptable::lookup(BED_LOOKUPTABLE, raw);
 
     #elif defined(BED_USES_AD595)
 
@@ -1166,9 +1724,15 @@ void Temperature::init() {
   // Wait for temperature measurement to settle
   delay(250);
 
+  // Thermistor limits are found in the tables at compile time. Other sensors are searched here.
   #define TEMP_MIN_ROUTINE(NR) \
     minttemp[NR] = HEATER_ ##NR## _MINTEMP; \
-    while (analog2temp(minttemp_raw[NR], NR) < HEATER_ ##NR## _MINTEMP) { \
+    if (HEATER_ ##NR## _LOOKUPTABLE != NULL) { \
+      constexpr int16_t raw = thermistor_lookuptable::raw_limit(HEATER_ ##NR## _THERMISTOR, \
+        HEATER_ ##NR## _RAW_LO_TEMP, HEATER_ ##NR## _RAW_HI_TEMP, HEATER_ ##NR## _MINTEMP, 1); \
+      minttemp_raw[NR] = raw; \
+    } \
+    else while (analog2temp(minttemp_raw[NR], NR) < HEATER_ ##NR## _MINTEMP) { \
       if (HEATER_ ##NR## _RAW_LO_TEMP < HEATER_ ##NR## _RAW_HI_TEMP) \
         minttemp_raw[NR] += OVERSAMPLENR; \
       else \
@@ -1176,7 +1740,12 @@ void Temperature::init() {
     }
   #define TEMP_MAX_ROUTINE(NR) \
     maxttemp[NR] = HEATER_ ##NR## _MAXTEMP; \
-    while (analog2temp(maxttemp_raw[NR], NR) > HEATER_ ##NR## _MAXTEMP) { \
+    if (HEATER_ ##NR## _LOOKUPTABLE != NULL) { \
+      constexpr int16_t raw = thermistor_lookuptable::raw_limit(HEATER_ ##NR## _THERMISTOR, \
+        HEATER_ ##NR## _RAW_HI_TEMP, HEATER_ ##NR## _RAW_LO_TEMP, HEATER_ ##NR## _MAXTEMP, -1); \
+      maxttemp_raw[NR] = raw; \
+    } \
+    else while (analog2temp(maxttemp_raw[NR], NR) > HEATER_ ##NR## _MAXTEMP) { \
       if (HEATER_ ##NR## _RAW_LO_TEMP < HEATER_ ##NR## _RAW_HI_TEMP) \
         maxttemp_raw[NR] -= OVERSAMPLENR; \
       else \
@@ -1224,22 +1793,34 @@ void Temperature::init() {
 
   #if HAS_TEMP_BED
     #ifdef BED_MINTEMP
-      while (analog2tempBed(bed_minttemp_raw) < BED_MINTEMP) {
-        #if HEATER_BED_RAW_LO_TEMP < HEATER_BED_RAW_HI_TEMP
-          bed_minttemp_raw += OVERSAMPLENR;
-        #else
-          bed_minttemp_raw -= OVERSAMPLENR;
-        #endif
-      }
+      #if ENABLED(BED_USES_THERMISTOR)
+        constexpr int16_t raw_min = thermistor_lookuptable::raw_limit(BED_THERMISTOR,
+          HEATER_BED_RAW_LO_TEMP, HEATER_BED_RAW_HI_TEMP, BED_MINTEMP, 1);
+        bed_minttemp_raw = raw_min;
+      #else
+        while (analog2tempBed(bed_minttemp_raw) < BED_MINTEMP) {
+          #if HEATER_BED_RAW_LO_TEMP < HEATER_BED_RAW_HI_TEMP
+            bed_minttemp_raw += OVERSAMPLENR;
+          #else
+            bed_minttemp_raw -= OVERSAMPLENR;
+          #endif
+        }
+      #endif
     #endif // BED_MINTEMP
     #ifdef BED_MAXTEMP
-      while (analog2tempBed(bed_maxttemp_raw) > BED_MAXTEMP) {
-        #if HEATER_BED_RAW_LO_TEMP < HEATER_BED_RAW_HI_TEMP
-          bed_maxttemp_raw -= OVERSAMPLENR;
-        #else
-          bed_maxttemp_raw += OVERSAMPLENR;
-        #endif
-      }
+      #if ENABLED(BED_USES_THERMISTOR)
+        constexpr int16_t raw_max = thermistor_lookuptable::raw_limit(BED_THERMISTOR,
+          HEATER_BED_RAW_HI_TEMP, HEATER_BED_RAW_LO_TEMP, BED_MAXTEMP, -1);
+        bed_maxttemp_raw = raw_max;
+      #else
+        while (analog2tempBed(bed_maxttemp_raw) > BED_MAXTEMP) {
+          #if HEATER_BED_RAW_LO_TEMP < HEATER_BED_RAW_HI_TEMP
+            bed_maxttemp_raw -= OVERSAMPLENR;
+          #else
+            bed_maxttemp_raw += OVERSAMPLENR;
+          #endif
+        }
+      #endif
     #endif // BED_MAXTEMP
   #endif // HAS_TEMP_BED
 
@@ -1343,6 +1924,7 @@ void Temperature::init() {
       case TRFirstHeating:
         if (current < tr_target_temperature[heater_index]) break;
         *state = TRStable;
+        // fall-through
       // While the temperature is stable watch for a bad temperature
       case TRStable:
         if (current >= tr_target_temperature[heater_index] - hysteresis_degc) {
@@ -1351,6 +1933,7 @@ void Temperature::init() {
         }
         else if (PENDING(millis(), *timer)) break;
         *state = TRRunaway;
+        // fall-through
       case TRRunaway:
         _temp_error(heater_id, PSTR(MSG_T_THERMAL_RUNAWAY), PSTR(MSG_THERMAL_RUNAWAY));
     }
@@ -1635,9 +2218,18 @@ volatile bool Temperature::in_temp_isr = false;
 void Temperature::isr() {
   // The stepper ISR can interrupt this ISR. When it does it re-enables this ISR
   // at the end of its run, potentially causing re-entry. This flag prevents it.
-  if (in_temp_isr) return;
+  if (in_temp_isr) {
+    #if ENABLED(ISR_STATISTICS)
+      temp_isr_stats.miss();
+    #endif
+    return;
+  }
   in_temp_isr = true;
 
+  #if ENABLED(ISR_STATISTICS)
+    const uint32_t isr_start = micros();
+  #endif
+
   // Allow UART and stepper ISRs
   CBI(TIMSK0, OCIE0B); //Disable Temperature ISR
   sei();
@@ -1960,6 +2552,7 @@ void Temperature::isr() {
     }
 
     #if HAS_TEMP_0
+      // fall-through
       case PrepareTemp_0:
         START_ADC(TEMP_0_PIN);
         break;
@@ -2056,6 +2649,11 @@ void Temperature::isr() {
     // Update the raw values if they've been read. Else we could be updating them during reading.
     if (!temp_meas_ready) set_current_temp_raw();
 
+    #if ENABLED(PID_FIXED_POINT)
+      // Run the PID loops at the fixed rate of the ADC readings
+      update_pid_fixed();
+    #endif
+
     // Filament Sensor - can be read any time since IIR filtering is used
     #if ENABLED(FILAMENT_WIDTH_SENSOR)
       current_raw_filwidth = raw_filwidth_value >> 10;  // Divide to get to 0-16384 range since we used 1/128 IIR filter approach
@@ -2164,6 +2762,10 @@ void Temperature::isr() {
   #endif
 
   cli();
+  #if ENABLED(ISR_STATISTICS)
+    const uint32_t isr_us = micros() - isr_start;
+    temp_isr_stats.sample(isr_us < 0xFFFF ? isr_us : 0xFFFF);
+  #endif
   in_temp_isr = false;
   SBI(TIMSK0, OCIE0B); //re-enable Temperature ISR
 }
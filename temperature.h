@@ -107,6 +107,47 @@ enum ADCSensorState {
   #define unscalePID_d(d) ( (d) * PID_dT )
 #endif
 
+#if ENABLED(PID_FIXED_POINT)
+  #define PID_K1_FIXED int16_t((PID_K1) * 256 + 0.5) // PID_K1 in 1/256
+
+  /**
+   * Gains and state of one fixed-point PID loop. Temperatures are in the
+   * 1/16 °C units of the thermistor lookup tables, and every term is in
+   * 1/65536 of a PWM step, so the terms add up without rescaling.
+   */
+  typedef struct {
+    int32_t Kp, Ki, Kd,     // Per 1/16 °C. Kd includes the (1 - PID_K1) smoothing.
+            pTerm, iTerm, dTerm;
+    int16_t error_limit,    // Errors are clamped to this, and temperature changes
+            delta_limit,    // to this, so products always fit in 32 bits
+            last_temp;
+    #if ENABLED(PID_EXTRUSION_SCALING)
+      int32_t Kc, cTerm,    // Kc per E step
+              steps_limit;
+    #endif
+  } pid_fixed_t;
+#endif
+
+#if ENABLED(PID_HEATUP_MODEL) || ENABLED(PID_AUTOTUNE_MODEL)
+  /**
+   * First-order model of a heater, as measured by M303
+   */
+  typedef struct {
+    float gain,           // °C above ambient held by each step of power (0-255)
+          time_constant,  // Seconds
+          dead_time,      // Seconds
+          ambient;        // °C
+  } heater_model_t;
+#endif
+
+#if ENABLED(PID_HEATUP_MODEL)
+  enum HeatupPhase : char {
+    HeatupOff,        // The PID is in charge
+    HeatupFullPower,  // Heating at full power until the model says to stop
+    HeatupHold        // Holding the target's power while the heat already applied arrives
+  };
+#endif
+
 #if !HAS_HEATER_BED
   constexpr int16_t target_temperature_bed = 0;
 #endif
@@ -161,6 +202,10 @@ class Temperature {
       static float bedKp, bedKi, bedKd;
     #endif
 
+    #if ENABLED(PID_HEATUP_MODEL)
+      static heater_model_t heater_model[HOTENDS];
+    #endif
+
     #if ENABLED(BABYSTEPPING)
       static volatile int babystepsTodo[3];
     #endif
@@ -223,6 +268,22 @@ class Temperature {
       static bool pid_reset[HOTENDS];
     #endif
 
+    #if ENABLED(PID_HEATUP_MODEL)
+      static HeatupPhase heatup_phase[HOTENDS];
+      static uint8_t heatup_power[HOTENDS];   // Power that holds the target
+      static millis_t heatup_hold_ms[HOTENDS];
+    #endif
+
+    #if ENABLED(PID_FIXED_POINT)
+      #if ENABLED(PIDTEMP)
+        static pid_fixed_t pid_fixed[HOTENDS];
+      #endif
+      #if ENABLED(PIDTEMPBED)
+        static pid_fixed_t pid_fixed_bed;
+      #endif
+      static bool pid_fixed_paused;
+    #endif
+
     #if ENABLED(PIDTEMPBED)
       static float temp_iState_bed,
                    temp_dState_bed,
@@ -453,12 +514,18 @@ class Temperature {
      * Perform auto-tuning for hotend or bed in response to M303
      */
     #if HAS_PID_HEATING
-      static void PID_autotune(const float &target, const int8_t hotend, const int8_t ncycles, const bool set_result=false);
+      static void PID_autotune(const float &target, const int8_t hotend, const int8_t ncycles, const bool set_result=false
+        #if ENABLED(PID_AUTOTUNE_MODEL)
+          , const bool fit_model=false
+        #endif
+      );
 
       /**
        * Update the temp manager when PID values change
        */
-      #if ENABLED(PIDTEMP)
+      #if ENABLED(PID_FIXED_POINT)
+        static void updatePID();
+      #elif ENABLED(PIDTEMP)
         FORCE_INLINE static void updatePID() {
           #if ENABLED(PID_EXTRUSION_SCALING)
             last_e_position = 0;
@@ -582,10 +649,23 @@ class Temperature {
 
     static float get_pid_output(const int8_t e);
 
+    #if ENABLED(PID_HEATUP_MODEL)
+      static void update_heatup_model(const uint8_t e);
+    #endif
+
     #if ENABLED(PIDTEMPBED)
       static float get_pid_output_bed();
     #endif
 
+    #if ENABLED(PID_FIXED_POINT)
+      static void set_pid_fixed_gains(pid_fixed_t &pid, const float &Kp, const float &Ki, const float &Kd, const uint8_t max_power
+        #if ENABLED(PID_EXTRUSION_SCALING)
+          , const float &Kc
+        #endif
+      );
+      static void update_pid_fixed();
+    #endif
+
     static void _temp_error(const int8_t e, const char * const serial_msg, const char * const lcd_msg);
     static void min_temp_error(const int8_t e);
     static void max_temp_error(const int8_t e);
@@ -612,4 +692,8 @@ class Temperature {
 
 extern Temperature thermalManager;
 
+#if ENABLED(PID_HEATUP_MODEL)
+  void gcode_M306();
+#endif
+
 #endif // TEMPERATURE_H
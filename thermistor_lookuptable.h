@@ -0,0 +1,305 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (C) 2016 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (C) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef THERMISTOR_LOOKUPTABLE_H
+#define THERMISTOR_LOOKUPTABLE_H
+
+#include "thermistortables.h"
+
+/**
+ * Raw ADC sum to temperature tables, generated at compile time from the
+ * thermistor tables in use, or from the model of a custom thermistor.
+ *
+ * Each table has a row for every ADC count, holding the temperature the
+ * thermistor table gives there in 1/16 °C. Converting a raw sum takes one
+ * row lookup and one multiply-add instead of a search of the thermistor
+ * table. Heaters with the same thermistor type share a table.
+ *
+ * Between ADC counts the rows are interpolated linearly, like the
+ * thermistor table, so only its points that fall between two counts are
+ * rounded off. Temperatures beyond ±2047 °C are clamped.
+ */
+
+#define THERMISTOR_LOOKUPTABLE_ROWS (1024 + 1) // Every 10-bit ADC count, and one more to interpolate to
+#define THERMISTOR_LOOKUPTABLE_SCALE 16        // Row units per °C
+
+namespace thermistor_lookuptable {
+
+  template<uint16_t... I> struct index_list { };
+
+  // Join two index lists, offsetting the second to follow the first
+  template<typename A, typename B> struct join;
+  template<uint16_t... A, uint16_t... B> struct join<index_list<A...>, index_list<B...> > {
+    typedef index_list<A..., (sizeof...(A) + B)...> type;
+  };
+
+  // The list 0..N-1, built by halves to keep the template depth low
+  template<uint16_t N> struct make_index_list {
+    typedef typename join<typename make_index_list<N / 2>::type, typename make_index_list<N - N / 2>::type>::type type;
+  };
+  template<> struct make_index_list<0> { typedef index_list<> type; };
+  template<> struct make_index_list<1> { typedef index_list<0> type; };
+
+  typedef short thermistor_row_t[2];
+
+  struct table_t { int16_t row[THERMISTOR_LOOKUPTABLE_ROWS]; };
+
+  /**
+   * A thermistor given by a thermistor table
+   */
+  struct table_thermistor_t { const thermistor_row_t *tt; uint8_t len; };
+
+  constexpr table_thermistor_t table_thermistor(const thermistor_row_t * const tt, const uint8_t len) { return { tt, len }; }
+
+  // The thermistor table's temperature at 'raw', searched from row i
+  constexpr float table_celsius(const thermistor_row_t * const tt, const uint8_t len, const int32_t raw, const uint8_t i=1) {
+    return i >= len ? tt[len - 1][1]
+      : tt[i][0] > raw ? tt[i - 1][1] + (raw - tt[i - 1][0]) * float(tt[i][1] - tt[i - 1][1]) / float(tt[i][0] - tt[i - 1][0])
+      : table_celsius(tt, len, raw, i + 1);
+  }
+
+  constexpr bool has_curve(const table_thermistor_t &t) { return t.len > 0; }
+  constexpr float curve_celsius(const table_thermistor_t &t, const int32_t raw) { return table_celsius(t.tt, t.len, raw); }
+
+  /**
+   * A thermistor given by its Steinhart-Hart coefficients, or by its Beta
+   * value and resistance at 25 °C, with the pull-up resistor it sits under.
+   * Its temperature is exact at every ADC count.
+   */
+  struct model_thermistor_t { float pullup, a, b, c; };
+
+  // ln(x) for the model, from the atanh series once x is scaled into [0.5, 1]
+  constexpr float ln_series(const float y2, const float term, const uint8_t k) {
+    return k > 21 ? 0 : term / k + ln_series(y2, term * y2, k + 2);
+  }
+  constexpr float ln_scaled(const float y) { return 2 * ln_series(y * y, y, 1); }
+  constexpr float ln(const float x) {
+    return x < 0.5 ? ln(x * 2) - M_LN2 : x > 1 ? ln(x * 0.5) + M_LN2 : ln_scaled((x - 1) / (x + 1));
+  }
+
+  constexpr model_thermistor_t steinhart_hart_thermistor(const float pullup, const float a, const float b, const float c) {
+    return { pullup, a, b, c };
+  }
+  constexpr model_thermistor_t beta_thermistor(const float pullup, const float r25, const float beta) {
+    return { pullup, float(1 / 298.15 - ln(r25) / beta), 1 / beta, 0 };
+  }
+
+  constexpr float kelvin_celsius(const float inv_kelvin) { return inv_kelvin > 0 ? 1 / inv_kelvin - 273.15 : 32767; }
+  constexpr float model_celsius(const model_thermistor_t &m, const float ln_r) {
+    return kelvin_celsius(m.a + m.b * ln_r + m.c * ln_r * ln_r * ln_r);
+  }
+
+  // The thermistor is the low side of the divider, so the ADC reads R / (R + pullup) of the full scale
+  constexpr bool has_curve(const model_thermistor_t&) { return true; }
+  constexpr float curve_celsius(const model_thermistor_t &m, const int32_t raw) {
+    return raw <= 0 ? 32767
+      : raw >= 1024L * (OVERSAMPLENR) ? -273.15
+      : model_celsius(m, ln(m.pullup * raw / (1024L * (OVERSAMPLENR) - raw)));
+  }
+
+  constexpr int16_t row_value(const float c) {
+    return c >= 32767.0 / (THERMISTOR_LOOKUPTABLE_SCALE) ? 32767
+      : c <= -32768.0 / (THERMISTOR_LOOKUPTABLE_SCALE) ? -32768
+      : int16_t(c * (THERMISTOR_LOOKUPTABLE_SCALE) + (c < 0 ? -0.5 : 0.5));
+  }
+
+  template<typename T>
+  constexpr int16_t row(const T &t, const uint16_t i) {
+    return row_value(curve_celsius(t, int32_t(i) * (OVERSAMPLENR)));
+  }
+
+  template<typename T, uint16_t... I>
+  constexpr table_t make_table(const T &t, index_list<I...>) {
+    return { { row(t, I)... } };
+  }
+
+  // Keep a raw value inside the table, below its last row
+  constexpr int16_t clamp_raw(const int32_t raw) {
+    return raw < 0 ? 0 : raw >= (THERMISTOR_LOOKUPTABLE_ROWS - 1) * (OVERSAMPLENR) ? (THERMISTOR_LOOKUPTABLE_ROWS - 1) * (OVERSAMPLENR) - 1 : raw;
+  }
+
+  // The temperature at a raw ADC sum. The result must match celsius() below.
+  FORCE_INLINE float lookup(const int16_t * const table, const int raw) {
+    const int16_t r = clamp_raw(raw);
+    const uint16_t i = (uint16_t)r / (OVERSAMPLENR);
+    const uint8_t f = (uint16_t)r % (OVERSAMPLENR);
+    const int16_t t0 = pgm_read_word(&table[i]), t1 = pgm_read_word(&table[i + 1]);
+    return ((int32_t)t0 * (OVERSAMPLENR) + ((int32_t)t1 - t0) * f) * (1.0 / ((OVERSAMPLENR) * (THERMISTOR_LOOKUPTABLE_SCALE)));
+  }
+
+  // lookup() in row units (1/16 °C), with no float math
+  FORCE_INLINE int16_t lookup_units(const int16_t * const table, const int raw) {
+    const int16_t r = clamp_raw(raw);
+    const uint16_t i = (uint16_t)r / (OVERSAMPLENR);
+    const uint8_t f = (uint16_t)r % (OVERSAMPLENR);
+    const int16_t t0 = pgm_read_word(&table[i]), t1 = pgm_read_word(&table[i + 1]);
+    return t0 + int16_t((((int32_t)t1 - t0) * f + (OVERSAMPLENR) / 2) / (OVERSAMPLENR));
+  }
+
+  // lookup() at compile time, working from the thermistor
+  template<typename T>
+  constexpr float celsius(const T &t, const int32_t raw) {
+    return (row(t, raw / (OVERSAMPLENR)) * int32_t(OVERSAMPLENR)
+            + (int32_t(row(t, raw / (OVERSAMPLENR) + 1)) - row(t, raw / (OVERSAMPLENR))) * (raw % (OVERSAMPLENR)))
+           * (1.0 / ((OVERSAMPLENR) * (THERMISTOR_LOOKUPTABLE_SCALE)));
+  }
+
+  // Whether the temperature at 'raw' has reached 'limit' going up (dir > 0) or down (dir < 0)
+  template<typename T>
+  constexpr bool reached(const T &t, const int32_t raw, const float limit, const int8_t dir) {
+    return dir > 0 ? celsius(t, raw) >= limit : celsius(t, raw) <= limit;
+  }
+
+  // The first of the steps lo..hi from 'from' that reaches 'limit', by bisection
+  template<typename T>
+  constexpr uint16_t first_step(const T &t, const int32_t from, const int16_t step,
+                                const float limit, const int8_t dir, const uint16_t lo, const uint16_t hi) {
+    return lo >= hi ? lo
+      : reached(t, clamp_raw(from + int32_t((lo + hi) / 2) * step), limit, dir)
+        ? first_step(t, from, step, limit, dir, lo, (lo + hi) / 2)
+        : first_step(t, from, step, limit, dir, (lo + hi) / 2 + 1, hi);
+  }
+
+  /**
+   * The raw value that a search from 'from' toward 'to', in steps of
+   * OVERSAMPLENR, stops at once the temperature has reached 'limit'.
+   * For MINTEMP the search goes up from the cold end (dir = 1) and for
+   * MAXTEMP it comes down from the hot end (dir = -1). Without a table
+   * it stays at 'from'.
+   */
+  template<typename T>
+  constexpr int16_t raw_limit(const T &t, const int16_t from, const int16_t to, const float limit, const int8_t dir) {
+    return !has_curve(t) ? from
+      : from + int32_t(first_step(t, from, from < to ? (OVERSAMPLENR) : -(OVERSAMPLENR), limit, dir,
+                                  0, (from < to ? to - from : from - to) / (OVERSAMPLENR))) * (from < to ? (OVERSAMPLENR) : -(OVERSAMPLENR));
+  }
+
+} // namespace thermistor_lookuptable
+
+/**
+ * Custom thermistors 1000 and 1001, by Steinhart-Hart coefficients if
+ * they are given or else by Beta value
+ */
+#ifdef THERMISTOR_1000_SH_C
+  #define THERMISTOR_1000 thermistor_lookuptable::steinhart_hart_thermistor(THERMISTOR_1000_PULLUP_OHMS, THERMISTOR_1000_SH_A, THERMISTOR_1000_SH_B, THERMISTOR_1000_SH_C)
+#else
+  #define THERMISTOR_1000 thermistor_lookuptable::beta_thermistor(THERMISTOR_1000_PULLUP_OHMS, THERMISTOR_1000_R25_OHMS, THERMISTOR_1000_BETA)
+#endif
+#ifdef THERMISTOR_1001_SH_C
+  #define THERMISTOR_1001 thermistor_lookuptable::steinhart_hart_thermistor(THERMISTOR_1001_PULLUP_OHMS, THERMISTOR_1001_SH_A, THERMISTOR_1001_SH_B, THERMISTOR_1001_SH_C)
+#else
+  #define THERMISTOR_1001 thermistor_lookuptable::beta_thermistor(THERMISTOR_1001_PULLUP_OHMS, THERMISTOR_1001_R25_OHMS, THERMISTOR_1001_BETA)
+#endif
+
+#define IS_CUSTOM_THERMISTOR(N) ((N) == 1000 || (N) == 1001)
+#define _CUSTOM_THERMISTOR(N) THERMISTOR_ ## N
+#define CUSTOM_THERMISTOR(N) _CUSTOM_THERMISTOR(N)
+
+// The thermistor of each heater, for the tables and the MINTEMP / MAXTEMP limits
+#if IS_CUSTOM_THERMISTOR(THERMISTORHEATER_0)
+  #define HEATER_0_THERMISTOR CUSTOM_THERMISTOR(THERMISTORHEATER_0)
+#else
+  #define HEATER_0_THERMISTOR thermistor_lookuptable::table_thermistor(HEATER_0_TEMPTABLE, HEATER_0_TEMPTABLE_LEN)
+#endif
+#if IS_CUSTOM_THERMISTOR(THERMISTORHEATER_1)
+  #define HEATER_1_THERMISTOR CUSTOM_THERMISTOR(THERMISTORHEATER_1)
+#else
+  #define HEATER_1_THERMISTOR thermistor_lookuptable::table_thermistor(HEATER_1_TEMPTABLE, HEATER_1_TEMPTABLE_LEN)
+#endif
+#if IS_CUSTOM_THERMISTOR(THERMISTORHEATER_2)
+  #define HEATER_2_THERMISTOR CUSTOM_THERMISTOR(THERMISTORHEATER_2)
+#else
+  #define HEATER_2_THERMISTOR thermistor_lookuptable::table_thermistor(HEATER_2_TEMPTABLE, HEATER_2_TEMPTABLE_LEN)
+#endif
+#if IS_CUSTOM_THERMISTOR(THERMISTORHEATER_3)
+  #define HEATER_3_THERMISTOR CUSTOM_THERMISTOR(THERMISTORHEATER_3)
+#else
+  #define HEATER_3_THERMISTOR thermistor_lookuptable::table_thermistor(HEATER_3_TEMPTABLE, HEATER_3_TEMPTABLE_LEN)
+#endif
+#if IS_CUSTOM_THERMISTOR(THERMISTORHEATER_4)
+  #define HEATER_4_THERMISTOR CUSTOM_THERMISTOR(THERMISTORHEATER_4)
+#else
+  #define HEATER_4_THERMISTOR thermistor_lookuptable::table_thermistor(HEATER_4_TEMPTABLE, HEATER_4_TEMPTABLE_LEN)
+#endif
+#if IS_CUSTOM_THERMISTOR(THERMISTORBED)
+  #define BED_THERMISTOR CUSTOM_THERMISTOR(THERMISTORBED)
+#else
+  #define BED_THERMISTOR thermistor_lookuptable::table_thermistor(BEDTEMPTABLE, BEDTEMPTABLE_LEN)
+#endif
+
+#define _THERMISTOR_LOOKUPTABLE(N) thermistor_lookuptable_ ## N
+#define THERMISTOR_LOOKUPTABLE(N) _THERMISTOR_LOOKUPTABLE(N)
+
+#define DEFINE_THERMISTOR_LOOKUPTABLE(N, THERMISTOR) \
+  const thermistor_lookuptable::table_t THERMISTOR_LOOKUPTABLE(N) PROGMEM = \
+    thermistor_lookuptable::make_table(THERMISTOR, thermistor_lookuptable::make_index_list<THERMISTOR_LOOKUPTABLE_ROWS>::type())
+
+// One table for each thermistor type in use
+#ifdef THERMISTORHEATER_0
+  DEFINE_THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_0, HEATER_0_THERMISTOR);
+#endif
+#if defined(THERMISTORHEATER_1) && THERMISTORHEATER_1 != THERMISTORHEATER_0
+  DEFINE_THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_1, HEATER_1_THERMISTOR);
+#endif
+#if defined(THERMISTORHEATER_2) && THERMISTORHEATER_2 != THERMISTORHEATER_0 && THERMISTORHEATER_2 != THERMISTORHEATER_1
+  DEFINE_THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_2, HEATER_2_THERMISTOR);
+#endif
+#if defined(THERMISTORHEATER_3) && THERMISTORHEATER_3 != THERMISTORHEATER_0 && THERMISTORHEATER_3 != THERMISTORHEATER_1 && THERMISTORHEATER_3 != THERMISTORHEATER_2
+  DEFINE_THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_3, HEATER_3_THERMISTOR);
+#endif
+#if defined(THERMISTORHEATER_4) && THERMISTORHEATER_4 != THERMISTORHEATER_0 && THERMISTORHEATER_4 != THERMISTORHEATER_1 && THERMISTORHEATER_4 != THERMISTORHEATER_2 && THERMISTORHEATER_4 != THERMISTORHEATER_3
+  DEFINE_THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_4, HEATER_4_THERMISTOR);
+#endif
+#if defined(THERMISTORBED) && THERMISTORBED != THERMISTORHEATER_0 && THERMISTORBED != THERMISTORHEATER_1 && THERMISTORBED != THERMISTORHEATER_2 && THERMISTORBED != THERMISTORHEATER_3 && THERMISTORBED != THERMISTORHEATER_4
+  DEFINE_THERMISTOR_LOOKUPTABLE(THERMISTORBED, BED_THERMISTOR);
+#endif
+
+#ifdef THERMISTORHEATER_0
+  #define HEATER_0_LOOKUPTABLE THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_0).row
+#else
+  #define HEATER_0_LOOKUPTABLE NULL
+#endif
+#ifdef THERMISTORHEATER_1
+  #define HEATER_1_LOOKUPTABLE THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_1).row
+#else
+  #define HEATER_1_LOOKUPTABLE NULL
+#endif
+#ifdef THERMISTORHEATER_2
+  #define HEATER_2_LOOKUPTABLE THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_2).row
+#else
+  #define HEATER_2_LOOKUPTABLE NULL
+#endif
+#ifdef THERMISTORHEATER_3
+  #define HEATER_3_LOOKUPTABLE THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_3).row
+#else
+  #define HEATER_3_LOOKUPTABLE NULL
+#endif
+#ifdef THERMISTORHEATER_4
+  #define HEATER_4_LOOKUPTABLE THERMISTOR_LOOKUPTABLE(THERMISTORHEATER_4).row
+#else
+  #define HEATER_4_LOOKUPTABLE NULL
+#endif
+#ifdef THERMISTORBED
+  #define BED_LOOKUPTABLE THERMISTOR_LOOKUPTABLE(THERMISTORBED).row
+#endif
+
+#endif // THERMISTOR_LOOKUPTABLE_H
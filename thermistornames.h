@@ -94,4 +94,10 @@
 #elif THERMISTOR_ID == 999
   #define THERMISTOR_NAME "Dummy 2"
 
+// Custom thermistors
+#elif THERMISTOR_ID == 1000
+  #define THERMISTOR_NAME "Custom 1"
+#elif THERMISTOR_ID == 1001
+  #define THERMISTOR_NAME "Custom 2"
+
 #endif // THERMISTOR_ID